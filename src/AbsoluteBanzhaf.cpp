@@ -23,7 +23,7 @@ std::vector<epic::bigFloat> epic::index::AbsoluteBanzhaf::calculate(Game* g) {
 		if (log::out.getLogLevel() <= log::info) {
 			log::out << log::info << "Number of times each player is a swing player:" << log::endl;
 
-			bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0(); // additional winning coalitions due to players of weight 0
+			bigInt factor = coalitionsOfPlayersWithWeight0(g); // additional winning coalitions due to players of weight 0
 			for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
 				gCalculator->to_bigInt(&tmp, n_sp[i]);
 			  	bigInt output = tmp * factor;				
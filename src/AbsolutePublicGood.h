@@ -30,15 +30,6 @@ public:
 
 	std::vector<bigFloat> calculate(Game* g) override;
 	std::string getFullName() override;
-
-protected:
-	/**
-	 * A function to compute the total number of minimal winning coalitions
-	 *
-	 * @param g The Game object for the current calculation
-	 * @param total_mwc The total number of minimal winning coalitions
-	 */
-	void numberOfMinimalWinningCoalitions(Game* g, bigInt* total_mwc);
 };
 
 } /* namespace epic::index */
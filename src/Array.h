@@ -1,6 +1,7 @@
 #ifndef EPIC_ARRAY_H_
 #define EPIC_ARRAY_H_
 
+#include "MemoryTracker.h"
 #include "types.h"
 
 #include <cstdlib>
@@ -67,13 +68,15 @@ public:
 	/**
 	 * allocating memory regarding the input parameters
 	 *
+	 * The memory gets allocated through the MemoryTracker, i.e. it counts for the tracked memory usage and limit.
+	 *
 	 * @param dim The address size
 	 * @param offset The offset. The array will contain dim - offset elements. Addressed from offset - dim - 1
 	 * @param value_initialize Defines whether the allocated values should be value initialized or not
 	 */
 	inline void alloc(longUInt dim, longUInt offset, bool value_initialize = false) {
 		longUInt size = dim - offset;
-		mPtr = value_initialize ? new T[size]() : new T[size];
+		mPtr = MemoryTracker::new_array<T>(size, value_initialize);
 		mSelfAllocated = true;
 
 		mDim = dim;
@@ -85,7 +88,7 @@ public:
 	 */
 	inline void free() {
 		if (mSelfAllocated && mPtr != nullptr) {
-			delete[] mPtr;
+			MemoryTracker::delete_array(mPtr);
 			mPtr = nullptr;
 			mSelfAllocated = false;
 		}
@@ -183,13 +186,15 @@ public:
 	/**
 	 * allocating memory regarding the input parameters
 	 *
+	 * The memory gets allocated through the MemoryTracker, i.e. it counts for the tracked memory usage and limit.
+	 *
 	 * @param dim_x defines the size of the first dimension
 	 * @param dim_y defines the size of the second dimension
 	 * @param value_initialize defines whether the allocated values should be value initialized or not
 	 */
 	inline void alloc(longUInt dim_x, longUInt dim_y, bool value_initialize = false) {
 		longUInt size = dim_x * dim_y;
-		mPtr = value_initialize ? new T[size]() : new T[size];
+		mPtr = MemoryTracker::new_array<T>(size, value_initialize);
 		mDimX = dim_x;
 		mDimY = dim_y;
 	}
@@ -199,7 +204,7 @@ public:
 	 */
 	inline void free() {
 		if (mPtr != nullptr) {
-			delete[] mPtr;
+			MemoryTracker::delete_array(mPtr);
 			mPtr = nullptr;
 		}
 	}
@@ -296,6 +301,8 @@ public:
 	/**
 	 * allocating memory regarding the input parameters
 	 *
+	 * The memory gets allocated through the MemoryTracker, i.e. it counts for the tracked memory usage and limit.
+	 *
 	 * @param dim_x defines the address size of the first dimension
 	 * @param dim_y defines the address size of the second dimension
 	 * @param offset_x defines the offset of the first dimension. The Array will contain dim_x - offset_x elements (indices from offset_x to dim_x - 1) in the first dimension
@@ -304,7 +311,7 @@ public:
 	 */
 	inline void alloc(longUInt dim_x, longUInt dim_y, longUInt offset_x, longUInt offset_y, bool value_initialize = false) {
 		longUInt size = (dim_x - offset_x) * (dim_y - offset_y);
-		mPtr = value_initialize ? new T[size]() : new T[size];
+		mPtr = MemoryTracker::new_array<T>(size, value_initialize);
 
 		mDimX = dim_x;
 		mDimY = dim_y;
@@ -317,7 +324,7 @@ public:
 	 */
 	inline void free() {
 		if (mPtr != nullptr) {
-			delete[] mPtr;
+			MemoryTracker::delete_array(mPtr);
 			mPtr = nullptr;
 		}
 	}
@@ -28,7 +28,7 @@ std::vector<epic::bigFloat> epic::index::Banzhaf::calculate(Game* g) {
 		bigFloat float_total_n_sp = tmp;
 
 		if (log::out.getLogLevel() <= log::info) {
-			bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0(); // additional winning coalitions due to players of weight 0
+			bigInt factor = coalitionsOfPlayersWithWeight0(g); // additional winning coalitions due to players of weight 0
  			bigFloat output = float_total_n_sp * factor;
 
 			log::out << log::info << "Total number of swings: " << GMPHelper::mpf_class_to_string(output) << log::endl;
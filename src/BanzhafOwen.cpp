@@ -2,6 +2,7 @@
 
 #include "Logging.h"
 #include "GlobalCalculator.h"
+#include "Parallel.h"
 
 #include <cmath>
 
@@ -11,9 +12,6 @@ epic::index::BanzhafOwen::BanzhafOwen()
 std::vector<epic::bigFloat> epic::index::BanzhafOwen::calculate(Game* g_) {
 	auto g = static_cast<PrecoalitionGame*>(g_);
 
-	lint::LargeNumber tmp;
-	gCalculator->alloc_largeNumber(tmp);
-
 	std::vector<bigFloat> solution(g->getNumberOfPlayers());
 	longUInt totalWeight = g->getWeightSum();
 	longUInt quota = g->getQuota();
@@ -23,38 +21,54 @@ std::vector<epic::bigFloat> epic::index::BanzhafOwen::calculate(Game* g_) {
 	gCalculator->assign_one(c[totalWeight]);
 	generalizedBackwardCountingPerWeight(g, c, g->getPrecoalitionWeights(), g->getNumberOfPrecoalitions());
 
-	ArrayOffset<lint::LargeNumber> cw(totalWeight + 1, quota);
-	gCalculator->allocInit_largeNumberArray(cw.getArrayPointer(), cw.getNumberOfElements());
+	bigFloat ExternalMultiplier;
+	{
+		bigInt big_tmp;
+		mpz_ui_pow_ui(big_tmp.get_mpz_t(), 2, g->getNumberOfPrecoalitions() - 1);
+		ExternalMultiplier = 1 / bigFloat(big_tmp);
+	}
+
+	/*
+	 * The precoalitions are independent of each other: They only read c and write the solution of their own members. Therefore the precoalitions get distributed onto multiple threads (the largest ones first), each thread using its own tables cw, cw2, cwi and banzhafsInternal.
+	 */
+	longUInt table_size = (totalWeight + 1 - quota) * 3 + g->getMaxPrecoalitionSize();
+	longUInt number_of_threads = Parallel::getNumberOfThreads(g->getNumberOfPrecoalitions(), table_size * gCalculator->getLargeNumberSize());
 
-	ArrayOffset<lint::LargeNumber> cw2(totalWeight + 1, quota);
-	gCalculator->alloc_largeNumberArray(cw2.getArrayPointer(), cw2.getNumberOfElements());
+	std::vector<ArrayOffset<lint::LargeNumber>> cws(number_of_threads), cw2s(number_of_threads), cwis(number_of_threads);
+	std::vector<ArrayOffset<lint::LargeNumber>> banzhafsInternals(number_of_threads);
+	for (longUInt t = 0; t < number_of_threads; ++t) {
+		cws[t].alloc(totalWeight + 1, quota);
+		gCalculator->allocInit_largeNumberArray(cws[t].getArrayPointer(), cws[t].getNumberOfElements());
 
-	ArrayOffset<lint::LargeNumber> cwi(totalWeight + 1, quota);
-	gCalculator->allocInit_largeNumberArray(cwi.getArrayPointer(), cwi.getNumberOfElements());
+		cw2s[t].alloc(totalWeight + 1, quota);
+		gCalculator->alloc_largeNumberArray(cw2s[t].getArrayPointer(), cw2s[t].getNumberOfElements());
 
-	auto banzhafsInternal = new lint::LargeNumber[g->getMaxPrecoalitionSize()];
-	gCalculator->alloc_largeNumberArray(banzhafsInternal, g->getMaxPrecoalitionSize());
+		cwis[t].alloc(totalWeight + 1, quota);
+		gCalculator->allocInit_largeNumberArray(cwis[t].getArrayPointer(), cwis[t].getNumberOfElements());
 
-	bigFloat ExternalMultiplier;
-	{
-		mpz_ui_pow_ui(mBigTmp.get_mpz_t(), 2, g->getNumberOfPrecoalitions() - 1);
-		ExternalMultiplier = 1 / bigFloat(mBigTmp);
+		banzhafsInternals[t].alloc(g->getMaxPrecoalitionSize(), 0);
+		gCalculator->alloc_largeNumberArray(banzhafsInternals[t].getArrayPointer(), banzhafsInternals[t].getNumberOfElements());
 	}
 
-	std::vector<longUInt> winternal(g->getMaxPrecoalitionSize());
+	std::vector<longUInt> order = precoalitionsBySize(g);
 
 	// Work out number of swings on level of precoalitions
-	for (longUInt i = 0; i < g->getNumberOfPrecoalitions(); i++) {
+	Parallel::for_each(g->getNumberOfPrecoalitions(), number_of_threads, [&](longUInt thread_id, longUInt task) {
+		longUInt i = order[task];
+		ArrayOffset<lint::LargeNumber>& cw = cws[thread_id];
+		ArrayOffset<lint::LargeNumber>& cw2 = cw2s[thread_id];
+		ArrayOffset<lint::LargeNumber>& cwi = cwis[thread_id];
+		ArrayOffset<lint::LargeNumber>& banzhafsInternal = banzhafsInternals[thread_id];
+		bigInt big_tmp;
+
 		coalitionsContainingPlayerFromAbove(g, cw, c, g->getPrecoalitionWeights()[i]);
 
 		//replicate vector c onto cw
-		for (longUInt ii = quota; ii <= totalWeight; ii++) {
-			//cw2[i] = cw[i];
-			gCalculator->assign(cw2[ii], cw[ii]);
-		}
+		gCalculator->assign(&cw2[quota], &cw[quota], totalWeight + 1 - quota);
 
 		longUInt nbPlayersInParti = g->getPrecoalitions()[i].size();
 		if (nbPlayersInParti > 1) {
+			std::vector<longUInt> winternal(nbPlayersInParti);
 			for (longUInt x = 0; x < nbPlayersInParti; ++x) {
 				winternal[x] = g->getWeights()[g->getPrecoalitions()[i][x]];
 				gCalculator->assign_zero(banzhafsInternal[x]);
@@ -66,40 +80,36 @@ std::vector<epic::bigFloat> epic::index::BanzhafOwen::calculate(Game* g_) {
 				coalitionsContainingPlayerFromAbove(g, cwi, cw2, winternal[ii]);
 
 				longUInt min = std::min(quota + winternal[ii] - 1, totalWeight);
-				for (longUInt iii = quota; iii <= min; iii++) {
-					gCalculator->plusEqual(banzhafsInternal[ii], cwi[iii]);
-				}
+				gCalculator->plusEqualSum(banzhafsInternal[ii], &cwi[quota], min + 1 - quota);
 
 				bigFloat InternalMultiplier;
 				{ // InternalMultiplier = 2^{nbPlayerInParti - 1}
-					mpz_ui_pow_ui(mBigTmp.get_mpz_t(), 2, nbPlayersInParti - 1);
-					InternalMultiplier = 1 / bigFloat(mBigTmp);
+					mpz_ui_pow_ui(big_tmp.get_mpz_t(), 2, nbPlayersInParti - 1);
+					InternalMultiplier = 1 / bigFloat(big_tmp);
 				}
-				gCalculator->to_bigInt(&mBigTmp, banzhafsInternal[ii]);
-				solution[g->getPrecoalitions()[i][ii]] = ExternalMultiplier * InternalMultiplier * mBigTmp;
+				gCalculator->to_bigInt(&big_tmp, banzhafsInternal[ii]);
+				solution[g->getPrecoalitions()[i][ii]] = ExternalMultiplier * InternalMultiplier * big_tmp;
 			}
 		} else {
 			//get sum of vector
+			lint::LargeNumber tmp;
+			gCalculator->alloc_largeNumber(tmp);
 			gCalculator->assign_zero(tmp);
 			longUInt min = std::min(quota + g->getPrecoalitionWeights()[i] - 1, totalWeight);
-			for (longUInt ii = quota; ii <= min; ++ii) {
-				gCalculator->plusEqual(tmp, cw[ii]);
-			}
-			bigInt banzhafs_external;
-			gCalculator->to_bigInt(&banzhafs_external, tmp);
-			solution[g->getPrecoalitions()[i][0]] = ExternalMultiplier * banzhafs_external;
+			gCalculator->plusEqualSum(tmp, &cw[quota], min + 1 - quota);
+			gCalculator->to_bigInt(&big_tmp, tmp);
+			gCalculator->free_largeNumber(tmp);
+			solution[g->getPrecoalitions()[i][0]] = ExternalMultiplier * big_tmp;
 		}
-	}
+	});
 
-	gCalculator->free_largeNumberArray(banzhafsInternal);
-	delete[] banzhafsInternal;
-
-	gCalculator->free_largeNumberArray(cw2.getArrayPointer());
-	gCalculator->free_largeNumberArray(cwi.getArrayPointer());
+	for (longUInt t = 0; t < number_of_threads; ++t) {
+		gCalculator->free_largeNumberArray(cws[t].getArrayPointer());
+		gCalculator->free_largeNumberArray(cw2s[t].getArrayPointer());
+		gCalculator->free_largeNumberArray(cwis[t].getArrayPointer());
+		gCalculator->free_largeNumberArray(banzhafsInternals[t].getArrayPointer());
+	}
 	gCalculator->free_largeNumberArray(c.getArrayPointer());
-	gCalculator->free_largeNumberArray(cw.getArrayPointer());
-
-	gCalculator->free_largeNumber(tmp);
 
 	return solution;
 }
@@ -111,9 +121,11 @@ std::string epic::index::BanzhafOwen::getFullName() {
 epic::longUInt epic::index::BanzhafOwen::getMemoryRequirement(Game* g_) {
 	auto g = static_cast<PrecoalitionGame*>(g_);
 
-	bigInt memory = (g->getWeightSum() + 1 - g->getQuota()) * gCalculator->getLargeNumberSize() * 4; // c, cw, cw2, cwi
-	memory += g->getMaxPrecoalitionSize() * gCalculator->getLargeNumberSize();						 // banzhafInternal
-	memory += g->getMaxPrecoalitionSize() * c_sizeof_longUInt;										 // winternal
+	bigInt table_size = (bigInt(g->getWeightSum() + 1 - g->getQuota()) * 3 + g->getMaxPrecoalitionSize()) * gCalculator->getLargeNumberSize();
+	longUInt number_of_threads = table_size.fits_ulong_p() ? Parallel::getNumberOfThreads(g->getNumberOfPrecoalitions(), table_size.get_ui()) : 1;
+
+	bigInt memory = (g->getWeightSum() + 1 - g->getQuota()) * gCalculator->getLargeNumberSize();		 // c
+	memory += (table_size + g->getMaxPrecoalitionSize() * c_sizeof_longUInt) * number_of_threads; // cw, cw2, cwi, banzhafInternal, winternal (one per thread)
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
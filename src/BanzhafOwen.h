@@ -14,9 +14,6 @@ public:
 	longUInt getMemoryRequirement(Game* g) override;
 	bigInt getMaxValueRequirement(ItfUpperBoundApproximation* approx) override;
 	lint::Operation getOperationRequirement() override;
-
-private:
-	bigInt mBigTmp;
 };
 
 } // namespace epic::index
@@ -1,104 +1,172 @@
 #include "BigIntCalculator.h"
 
 #include "Logging.h"
+#include "MemoryTracker.h"
 
-#include <sstream>
+#include <cmath>
+#include <vector>
 
-epic::lint::BigIntCalculator::BigIntCalculator() {
-	log::out << log::info << "Using GMP library" << log::endl;
+epic::lint::BigIntCalculator::BigIntCalculator(const bigInt& max_value) {
+	// smallest number of limbs such that 2^(mLimbs * GMP_NUMB_BITS) > max_value
+	mLimbs = (mpz_sizeinbase(max_value.get_mpz_t(), 2) / GMP_NUMB_BITS) + 1;
+
+	log::out << log::info << "Using GMP library (" << mLimbs << " limbs per number)" << log::endl;
 }
 
 /**
- * @note This implementation returns 0 since each bigInt can independently grow in size (no static size)!
+ * @note Since all numbers use the same fixed number of limbs, this size is exact.
  */
 epic::longUInt epic::lint::BigIntCalculator::getLargeNumberSize() {
-	return 0;
+	return sizeof(LargeNumber) + (mLimbs * sizeof(mp_limb_t));
 }
 
 void epic::lint::BigIntCalculator::increment(LargeNumber& dest) {
-	++(*dest.bint);
+	mpn_add_1(dest.limbs, dest.limbs, mLimbs, 1);
 }
 
 void epic::lint::BigIntCalculator::plus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) {
-	*dest.bint = *op1.bint + *op2.bint;
+	mpn_add_n(dest.limbs, op1.limbs, op2.limbs, mLimbs);
 }
 
 void epic::lint::BigIntCalculator::plusEqual(LargeNumber& dest, const longUInt& op) {
-	*dest.bint += op;
+	mpn_add_1(dest.limbs, dest.limbs, mLimbs, op);
 }
 
 void epic::lint::BigIntCalculator::plusEqual(LargeNumber& dest, const LargeNumber& op) {
-	*dest.bint += *op.bint;
+	mpn_add_n(dest.limbs, dest.limbs, op.limbs, mLimbs);
+}
+
+void epic::lint::BigIntCalculator::plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		mpn_add_n(dest[i].limbs, dest[i].limbs, op[i].limbs, mLimbs);
+	}
+}
+
+void epic::lint::BigIntCalculator::plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) {
+	for (longUInt i = 0; i < n; ++i) {
+		mpn_add_n(dest.limbs, dest.limbs, op[i * stride].limbs, mLimbs);
+	}
 }
 
 void epic::lint::BigIntCalculator::minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) {
-	*dest.bint = *op1.bint - *op2.bint;
+	mpn_sub_n(dest.limbs, op1.limbs, op2.limbs, mLimbs);
+}
+
+void epic::lint::BigIntCalculator::minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		mpn_sub_n(dest[i].limbs, op1[i].limbs, op2[i].limbs, mLimbs);
+	}
 }
 
 void epic::lint::BigIntCalculator::minusEqual(LargeNumber& dest, const LargeNumber& op) {
-	*dest.bint -= *op.bint;
+	mpn_sub_n(dest.limbs, dest.limbs, op.limbs, mLimbs);
 }
 
 void epic::lint::BigIntCalculator::mul(LargeNumber& dest, const LargeNumber& op1, const longUInt& op2) {
-	*dest.bint = *op1.bint * op2;
+	mpn_mul_1(dest.limbs, op1.limbs, mLimbs, op2);
 }
 
+/**
+ * @note Only the lower mLimbs limbs of the product are calculated (schoolbook multiplication). Since dest may overlap op1 or op2, the product gets calculated into a thread local temporary first.
+ */
 void epic::lint::BigIntCalculator::mul(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) {
-	*dest.bint = *op1.bint * *op2.bint;
+	thread_local std::vector<mp_limb_t> tmp;
+	tmp.resize(mLimbs);
+
+	mpn_mul_1(tmp.data(), op1.limbs, mLimbs, op2.limbs[0]);
+	for (mp_size_t i = 1; i < mLimbs; ++i) {
+		mpn_addmul_1(tmp.data() + i, op1.limbs, mLimbs - i, op2.limbs[i]);
+	}
+
+	mpn_copyi(dest.limbs, tmp.data(), mLimbs);
 }
 
 void epic::lint::BigIntCalculator::mulEqual(LargeNumber& dest, const LargeNumber& op) {
-	*dest.bint *= *op.bint;
+	mul(dest, dest, op);
 }
 
 void epic::lint::BigIntCalculator::assign(LargeNumber& dest, const LargeNumber& value) {
-	*dest.bint = *value.bint;
+	mpn_copyi(dest.limbs, value.limbs, mLimbs);
 }
 
 void epic::lint::BigIntCalculator::assign(LargeNumber& dest, const longUInt& value) {
-	*dest.bint = value;
+	mpn_zero(dest.limbs, mLimbs);
+	dest.limbs[0] = value;
 }
 
 void epic::lint::BigIntCalculator::assign_zero(LargeNumber& dest) {
-	*dest.bint = 0;
+	mpn_zero(dest.limbs, mLimbs);
+}
+
+void epic::lint::BigIntCalculator::assign(LargeNumber* dest, const LargeNumber* src, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		mpn_copyi(dest[i].limbs, src[i].limbs, mLimbs);
+	}
+}
+
+void epic::lint::BigIntCalculator::assign_zero(LargeNumber* dest, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		mpn_zero(dest[i].limbs, mLimbs);
+	}
 }
 
 void epic::lint::BigIntCalculator::assign_one(LargeNumber& dest) {
-	*dest.bint = 1;
+	mpn_zero(dest.limbs, mLimbs);
+	dest.limbs[0] = 1;
 }
 
 void epic::lint::BigIntCalculator::to_bigInt(bigInt* dest, const LargeNumber& value) {
-	*dest = *value.bint;
+	mp_limb_t* dest_limbs = mpz_limbs_write(dest->get_mpz_t(), mLimbs);
+	mpn_copyi(dest_limbs, value.limbs, mLimbs);
+	mpz_limbs_finish(dest->get_mpz_t(), mLimbs); // normalizes the size (leading zero limbs)
+}
+
+void epic::lint::BigIntCalculator::to_double(double* dest, const LargeNumber* value, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		const mp_limb_t* limbs = value[i].limbs;
+
+		mp_size_t top = mLimbs - 1;
+		while (top > 0 && limbs[top] == 0) {
+			--top;
+		}
+
+		// the two most significant limbs are enough for the 53 bits of a double
+		double d = std::ldexp(static_cast<double>(limbs[top]), top * GMP_NUMB_BITS);
+		if (top > 0) {
+			d += std::ldexp(static_cast<double>(limbs[top - 1]), (top - 1) * GMP_NUMB_BITS);
+		}
+		dest[i] = d;
+	}
 }
 
 void epic::lint::BigIntCalculator::alloc_largeNumberArray(LargeNumber* array, longUInt number_of_elements) {
-	auto mem_pool = new bigInt[number_of_elements];
+	auto mem_pool = MemoryTracker::new_array<mp_limb_t>(number_of_elements * mLimbs);
 
 	for (longUInt i = 0; i < number_of_elements; ++i) {
-		array[i].bint = mem_pool + i;
+		array[i].limbs = mem_pool + (i * mLimbs);
 	}
 }
 
 void epic::lint::BigIntCalculator::allocInit_largeNumberArray(LargeNumber* array, longUInt number_of_elements) {
-	auto mem_pool = new bigInt[number_of_elements]();
+	auto mem_pool = MemoryTracker::new_array<mp_limb_t>(number_of_elements * mLimbs, true);
 
 	for (longUInt i = 0; i < number_of_elements; ++i) {
-		array[i].bint = mem_pool + i;
+		array[i].limbs = mem_pool + (i * mLimbs);
 	}
 }
 
 void epic::lint::BigIntCalculator::free_largeNumberArray(LargeNumber* array) {
-	delete[] array[0].bint;
+	MemoryTracker::delete_array(array[0].limbs);
 }
 
 void epic::lint::BigIntCalculator::alloc_largeNumber(LargeNumber& big_number) {
-	big_number.bint = new bigInt;
+	big_number.limbs = MemoryTracker::new_array<mp_limb_t>(mLimbs);
 }
 
 void epic::lint::BigIntCalculator::allocInit_largeNumber(LargeNumber& big_number) {
-	big_number.bint = new bigInt(0);
+	big_number.limbs = MemoryTracker::new_array<mp_limb_t>(mLimbs, true);
 }
 
 void epic::lint::BigIntCalculator::free_largeNumber(LargeNumber& big_number) {
-	delete big_number.bint;
+	MemoryTracker::delete_array(big_number.limbs);
 }
@@ -6,15 +6,18 @@
 namespace epic::lint {
 
 /**
-* An implementation of the ItfLargeNumberCalculator interface wrapping a bigInt variable
-*
-* This implementation is only used if the values to represent are small enough to fit into a single integer variable. In that case no chinese lint theorem is needed. However this wrapper class is necessary to get the same ChineseNumber handling no matter if the chinese lint theorem is needed and applied.
-*
-* @remark This implementation only uses the ChineseNumber's uint member. That's why the alloc and free methods are empty.
-*/
+ * An implementation of the ItfLargeNumberCalculator interface using fixed-size GMP limb arrays (mpn layer)
+ *
+ * Each LargeNumber holds a fixed number of limbs that is large enough to represent the maximum value passed to the constructor. All numbers of an array get allocated in one single memory block, i.e. no per-value heap allocations are needed (in contrast to the use of one mpz_class object per value).
+ *
+ * All operations are done modulo 2^(mLimbs * GMP_NUMB_BITS). As long as the final values do not exceed the maximum value, intermediate results (e.g. differences getting temporarily negative) are handled correctly, the same way as done by the ChineseRemainder implementation.
+ */
 class BigIntCalculator : public ItfLargeNumberCalculator {
 public:
-	BigIntCalculator();
+	/**
+	 * @param max_value The maximum value that needs to be representable. It defines the number of limbs each LargeNumber uses.
+	 */
+	explicit BigIntCalculator(const bigInt& max_value);
 
 	longUInt getLargeNumberSize() override;
 
@@ -23,7 +26,10 @@ public:
 	void plus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
 	void plusEqual(LargeNumber& dest, const longUInt& op) override;
 	void plusEqual(LargeNumber& dest, const LargeNumber& op) override;
+	void plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) override;
+	void plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) override;
 	void minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
+	void minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) override;
 	void minusEqual(LargeNumber& dest, const LargeNumber& op) override;
 	void mul(LargeNumber& dest, const LargeNumber& op1, const longUInt& op2) override;
 	void mul(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
@@ -32,9 +38,12 @@ public:
 	void assign(LargeNumber& dest, const LargeNumber& value) override;
 	void assign(LargeNumber& dest, const longUInt& value) override;
 	void assign_zero(LargeNumber& dest) override;
+	void assign(LargeNumber* dest, const LargeNumber* src, longUInt n) override;
+	void assign_zero(LargeNumber* dest, longUInt n) override;
 	void assign_one(LargeNumber& dest) override;
 
 	void to_bigInt(bigInt* dest, const LargeNumber& value) override;
+	void to_double(double* dest, const LargeNumber* value, longUInt n) override;
 
 	void alloc_largeNumberArray(LargeNumber* array, longUInt number_of_elements) override;
 	void allocInit_largeNumberArray(LargeNumber* array, longUInt number_of_elements) override;
@@ -43,6 +52,12 @@ public:
 	void alloc_largeNumber(LargeNumber& big_number) override;
 	void allocInit_largeNumber(LargeNumber& big_number) override;
 	void free_largeNumber(LargeNumber& big_number) override;
+
+private:
+	/**
+	 * The number of limbs per LargeNumber
+	 */
+	mp_size_t mLimbs;
 };
 
 } /* namespace epic::lint */
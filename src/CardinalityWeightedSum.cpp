@@ -0,0 +1,101 @@
+#include "CardinalityWeightedSum.h"
+
+#include "GlobalCalculator.h"
+#include "Parallel.h"
+
+#include <functional>
+
+void epic::index::CardinalityWeightedSum::factorialWeightedSum(Array2d<lint::LargeNumber>& table, longUInt players, longUInt n, std::vector<bigInt>& result) {
+	result.assign(players, bigInt(0));
+	if (players == 0 || n == 0) {
+		return;
+	}
+
+	// only a few cardinalities: the multiplications by the weights are cheaper than the recursion
+	if (n < cMinSplittingCardinalities) {
+		// factorial[x]: x!, weight[k]: (k - 1)! * (n - k)!
+		std::vector<bigInt> factorial(n + 1), weight(n + 1);
+		factorial[0] = 1;
+		for (longUInt k = 1; k <= n; ++k) {
+			factorial[k] = factorial[k - 1] * k;
+		}
+		for (longUInt k = 1; k <= n; ++k) {
+			weight[k] = factorial[k - 1] * factorial[n - k];
+		}
+
+		longUInt number_of_threads = Parallel::getNumberOfThreads(players, GMPHelper::size_of_int(factorial[n]) * 2);
+		Parallel::for_each(players, number_of_threads, [&](longUInt, longUInt i) {
+			std::vector<bigInt> row(n + 1);
+			gCalculator->to_bigInt(&row[1], &table(i, 1), n);
+
+			for (longUInt k = 1; k <= n; ++k) {
+				mpz_addmul(result[i].get_mpz_t(), row[k].get_mpz_t(), weight[k].get_mpz_t());
+			}
+		});
+		return;
+	}
+
+	/*
+	 * The nodes of the splitting tree over the cardinalities [1, n + 1) (node 1: the root, 2 * x and 2 * x + 1: the children of node x)
+	 * left[x]: product of k over the cardinalities k of node x
+	 * right[x]: product of n - k + 1 over the cardinalities k of node x
+	 */
+	std::vector<bigInt> left(4 * n), right(4 * n);
+	std::function<void(longUInt, longUInt, longUInt)> buildProducts = [&](longUInt node, longUInt lo, longUInt hi) {
+		if (hi - lo == 1) {
+			left[node] = lo;
+			right[node] = n - lo + 1;
+			return;
+		}
+
+		longUInt mid = lo + (hi - lo) / 2;
+		buildProducts(2 * node, lo, mid);
+		buildProducts(2 * node + 1, mid, hi);
+		left[node] = left[2 * node] * left[2 * node + 1];
+		right[node] = right[2 * node] * right[2 * node + 1];
+	};
+	buildProducts(1, 1, n + 1);
+
+	// F(lo, hi) = F(lo, mid) * right(mid, hi) + left(lo, mid) * F(mid, hi)
+	std::function<void(const std::vector<bigInt>&, longUInt, longUInt, longUInt, bigInt&)> combine = [&](const std::vector<bigInt>& row, longUInt node, longUInt lo, longUInt hi, bigInt& dest) {
+		if (hi - lo == 1) {
+			dest = row[lo];
+			return;
+		}
+
+		longUInt mid = lo + (hi - lo) / 2;
+		bigInt upper;
+		combine(row, 2 * node, lo, mid, dest);
+		combine(row, 2 * node + 1, mid, hi, upper);
+		dest *= right[2 * node + 1];
+		upper *= left[2 * node];
+		dest += upper;
+	};
+
+	// a few numbers of the size of the result (n!) per recursion level
+	longUInt memory_per_thread = GMPHelper::size_of_int(left[1]) * 4;
+	longUInt number_of_threads = Parallel::getNumberOfThreads(players, memory_per_thread);
+
+	Parallel::for_each(players, number_of_threads, [&](longUInt, longUInt i) {
+		std::vector<bigInt> row(n + 1);
+		gCalculator->to_bigInt(&row[1], &table(i, 1), n);
+
+		combine(row, 1, 1, n + 1, result[i]);
+	});
+}
+
+void epic::index::CardinalityWeightedSum::weightedSum(Array2d<lint::LargeNumber>& table, longUInt players, longUInt n, const std::vector<bigFloat>& weights, std::vector<bigFloat>& result) {
+	result.assign(players, bigFloat(0));
+	longUInt number_of_threads = Parallel::getNumberOfThreads(players, 0);
+
+	Parallel::for_each(players, number_of_threads, [&](longUInt, longUInt i) {
+		std::vector<bigInt> row(n + 1);
+		gCalculator->to_bigInt(&row[1], &table(i, 1), n);
+
+		for (longUInt k = 1; k <= n; ++k) {
+			if (row[k] != 0) {
+				result[i] += weights[k] * row[k];
+			}
+		}
+	});
+}
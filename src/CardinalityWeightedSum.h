@@ -0,0 +1,57 @@
+#ifndef EPIC_INDEX_CARDINALITYWEIGHTEDSUM_H_
+#define EPIC_INDEX_CARDINALITYWEIGHTEDSUM_H_
+
+#include "Array.h"
+#include "LargeNumber.h"
+#include "types.h"
+
+#include <vector>
+
+namespace epic::index {
+
+/**
+ * The final stage of the indices based on counts per player and cardinality (e.g. RawShapleyShubik, RawShapleyShubikBelow, RawPowerIndexF and PublicHelpXi): combining each row of an n x (n + 1) table with weights depending on the cardinality.
+ *
+ * The rows are independent, i.e. the players get distributed onto multiple threads (see Parallel). Each row gets converted as a whole (see ItfLargeNumberCalculator::to_bigInt()) and combined using plain bigInt / bigFloat arithmetic.
+ */
+class CardinalityWeightedSum {
+public:
+	CardinalityWeightedSum() = delete;
+
+	/**
+	 * Calculating result[i] = sum_{k = 1}^{n} table(i, k) * (k - 1)! * (n - k)! for each player i in [0, players) (the raw Shapley-Shubik index)
+	 *
+	 * The factorial weights do not get multiplied separately. Consecutive weights differ by the factor k / (n - k), i.e. the sum gets split recursively (binary splitting):
+	 *
+	 * F(lo, hi) = F(lo, mid) * B(mid, hi) + A(lo, mid) * F(mid, hi)
+	 *
+	 * with the products A(lo, mid) = lo * ... * (mid - 1) and B(mid, hi) = (n - mid + 1) * ... * (n - hi + 2). The products only depend on n and get calculated once for all players. Each player only needs multiplications of balanced sizes instead of n multiplications by numbers of about log2(n!) bits.
+	 *
+	 * @param table The table containing the counts (at least in the range [0, players - 1] x [1, n])
+	 * @param players The number of rows to combine
+	 * @param n The number of cardinalities (the number of non-zero players)
+	 * @param result Return vector (gets resized to players)
+	 */
+	static void factorialWeightedSum(Array2d<lint::LargeNumber>& table, longUInt players, longUInt n, std::vector<bigInt>& result);
+
+	/**
+	 * Calculating result[i] = sum_{k = 1}^{n} weights[k] * table(i, k) for each player i in [0, players)
+	 *
+	 * @param table The table containing the counts (at least in the range [0, players - 1] x [1, n])
+	 * @param players The number of rows to combine
+	 * @param n The number of cardinalities
+	 * @param weights The weights of the cardinalities (at least n + 1 elements, weights[0] does not get used)
+	 * @param result Return vector (gets resized to players)
+	 */
+	static void weightedSum(Array2d<lint::LargeNumber>& table, longUInt players, longUInt n, const std::vector<bigFloat>& weights, std::vector<bigFloat>& result);
+
+private:
+	/**
+	 * The minimum number of cardinalities for the binary splitting of factorialWeightedSum(). Below, each player multiplies its counts by the precalculated weights.
+	 */
+	static constexpr longUInt cMinSplittingCardinalities = 512;
+};
+
+} /* namespace epic::index */
+
+#endif /* EPIC_INDEX_CARDINALITYWEIGHTEDSUM_H_ */
@@ -0,0 +1,159 @@
+#include "CheckedUIntCalculator.h"
+
+#include "Logging.h"
+
+#include <algorithm>
+
+epic::lint::CheckedUIntCalculator::CheckedUIntCalculator()
+	: mOverflow(false) {
+	log::out << log::info << "Checking for overflows (the calculation gets repeated using a larger representation if necessary)" << log::endl;
+}
+
+bool epic::lint::CheckedUIntCalculator::hasOverflowed() const {
+	return mOverflow.load(std::memory_order_relaxed);
+}
+
+void epic::lint::CheckedUIntCalculator::setOverflow() {
+	mOverflow.store(true, std::memory_order_relaxed);
+}
+
+void epic::lint::CheckedUIntCalculator::increment(LargeNumber& dest) {
+	longUInt result;
+	bool overflow = __builtin_add_overflow(dest.uint, longUInt{1}, &result);
+	dest.uint = result;
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::plus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) {
+	longUInt result;
+	bool overflow = __builtin_add_overflow(op1.uint, op2.uint, &result);
+	dest.uint = result;
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::plusEqual(LargeNumber& dest, const longUInt& op) {
+	longUInt result;
+	bool overflow = __builtin_add_overflow(dest.uint, op, &result);
+	dest.uint = result;
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::plusEqual(LargeNumber& dest, const LargeNumber& op) {
+	longUInt result;
+	bool overflow = __builtin_add_overflow(dest.uint, op.uint, &result);
+	dest.uint = result;
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) {
+	// same blocking as in UIntCalculator::plusEqual()
+	longUInt block = n;
+	if (op > dest && static_cast<longUInt>(op - dest) < n) {
+		block = op - dest;
+	}
+
+	bool overflow = false;
+	for (longUInt begin = 0; begin < n; begin += block) {
+		longUInt size = std::min(block, n - begin);
+		LargeNumber* __restrict d = dest + begin;
+		const LargeNumber* __restrict o = op + begin;
+
+		for (longUInt i = 0; i < size; ++i) {
+			longUInt result;
+			overflow |= __builtin_add_overflow(d[i].uint, o[i].uint, &result);
+			d[i].uint = result;
+		}
+	}
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) {
+	longUInt result;
+	bool overflow = __builtin_sub_overflow(op1.uint, op2.uint, &result);
+	dest.uint = result;
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) {
+	bool overflow = false;
+	longUInt sum = dest.uint;
+	for (longUInt i = 0; i < n; ++i) {
+		overflow |= __builtin_add_overflow(sum, op[i * stride].uint, &sum);
+	}
+	dest.uint = sum;
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) {
+	bool overflow = false;
+	for (longUInt i = 0; i < n; ++i) {
+		longUInt result;
+		overflow |= __builtin_sub_overflow(op1[i].uint, op2[i].uint, &result);
+		dest[i].uint = result;
+	}
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::minusEqual(LargeNumber& dest, const LargeNumber& op) {
+	longUInt result;
+	bool overflow = __builtin_sub_overflow(dest.uint, op.uint, &result);
+	dest.uint = result;
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::mul(LargeNumber& dest, const LargeNumber& op1, const longUInt& op2) {
+	longUInt result;
+	bool overflow = __builtin_mul_overflow(op1.uint, op2, &result);
+	dest.uint = result;
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::mul(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) {
+	longUInt result;
+	bool overflow = __builtin_mul_overflow(op1.uint, op2.uint, &result);
+	dest.uint = result;
+
+	if (overflow) {
+		setOverflow();
+	}
+}
+
+void epic::lint::CheckedUIntCalculator::mulEqual(LargeNumber& dest, const LargeNumber& op) {
+	longUInt result;
+	bool overflow = __builtin_mul_overflow(dest.uint, op.uint, &result);
+	dest.uint = result;
+
+	if (overflow) {
+		setOverflow();
+	}
+}
@@ -0,0 +1,52 @@
+#ifndef EPIC_LINT_CHECKEDUINTCALCULATOR_H_
+#define EPIC_LINT_CHECKEDUINTCALCULATOR_H_
+
+#include "UIntCalculator.h"
+
+#include <atomic>
+
+namespace epic::lint {
+
+/**
+ * An UIntCalculator detecting overflows
+ *
+ * The upper bound a calculator gets chosen for (CalculatorConfig::maxValue) is a worst case approximation. For many games all values of all tables fit into a single integer variable even if the bound requires more. This calculator allows to try the calculation using single integers first: Each operation checks for an overflow (or a negative difference) and remembers if one occurred. If no overflow occurred during the whole calculation, each value equals its exact (non-negative) value, i.e. the result is correct. Otherwise the calculation needs to get repeated using the calculator chosen for the upper bound (see GlobalCalculator::initOptimistic()).
+ *
+ * @note The overflow flag is sticky. Once set, it stays set until the calculator gets deleted.
+ * @note The checked operations compute into a local variable and store it afterwards. Their operands are references that may refer to the destination (e.g. minus(f[k], f[k], f[k - w])). GCC 12 expands the overflow builtins with such operands into storing the result first and reading the operands again for the overflow check, i.e. the check would see the result instead of the operand.
+ */
+class CheckedUIntCalculator : public UIntCalculator {
+public:
+	CheckedUIntCalculator();
+
+	/**
+	 * @return true if at least one operation over- or underflowed since the construction of this object
+	 */
+	bool hasOverflowed() const;
+
+	void increment(LargeNumber& dest) override;
+
+	void plus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
+	void plusEqual(LargeNumber& dest, const longUInt& op) override;
+	void plusEqual(LargeNumber& dest, const LargeNumber& op) override;
+	void plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) override;
+	void plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) override;
+	void minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
+	void minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) override;
+	void minusEqual(LargeNumber& dest, const LargeNumber& op) override;
+	void mul(LargeNumber& dest, const LargeNumber& op1, const longUInt& op2) override;
+	void mul(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
+	void mulEqual(LargeNumber& dest, const LargeNumber& op) override;
+
+private:
+	std::atomic<bool> mOverflow;
+
+	/**
+	 * Setting the overflow flag. Only called in the (rare) case of an overflow, therefore the normal operation does not touch the atomic flag at all.
+	 */
+	void setOverflow();
+};
+
+} /* namespace epic::lint */
+
+#endif /* EPIC_LINT_CHECKEDUINTCALCULATOR_H_ */
@@ -1,8 +1,12 @@
 #include "ChineseRemainder.h"
 
 #include "Logging.h"
+#include "MemoryTracker.h"
 
+#include <algorithm>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 epic::lint::ChineseRemainder::ChineseRemainder(const longUInt* primes, const size_t amount, const bigInt& m)
 	: mPrimes(primes), mAmount(amount), mM(m) {
@@ -21,6 +25,35 @@ epic::lint::ChineseRemainder::ChineseRemainder(const longUInt* primes, const siz
 		mFactors[i] = Mi * Mi_inverse;
 	}
 
+	// calculate the inverse elements needed for the to_double conversion
+	mInverses = new longUInt[amount * amount]();
+	mInversesShoup = new longUInt[amount * amount]();
+	bigInt big_prime_j;
+	for (size_t i = 0; i < amount; ++i) {
+		big_prime = mPrimes[i];
+		for (size_t j = 0; j < i; ++j) {
+			big_prime_j = mPrimes[j];
+			if (mpz_invert(Mi_inverse.get_mpz_t(), big_prime_j.get_mpz_t(), big_prime.get_mpz_t()) == 0) {
+				throw std::runtime_error("unexpected error while calculating the modulo inverse elements of the primes!");
+			}
+			mInverses[i * amount + j] = Mi_inverse.get_ui();
+			mInversesShoup[i * amount + j] = static_cast<longUInt>((static_cast<unsigned __int128>(mInverses[i * amount + j]) << 64) / mPrimes[i]);
+		}
+	}
+
+	// the headroom for lazy reductions: (k + 1) * (max_prime - 1) must fit into a longUInt (unsigned __int128 for products)
+	mReciprocals = new longUInt[amount];
+	longUInt max_prime = 0;
+	for (size_t i = 0; i < amount; ++i) {
+		mReciprocals[i] = std::numeric_limits<longUInt>::max() / mPrimes[i];
+		max_prime = std::max(max_prime, mPrimes[i]);
+	}
+
+	mLazyAdditions = std::numeric_limits<longUInt>::max() / (max_prime - 1) - 1;
+	unsigned __int128 max_product = static_cast<unsigned __int128>(max_prime - 1) * (max_prime - 1);
+	unsigned __int128 lazy_products = ~static_cast<unsigned __int128>(0) / max_product - 1;
+	mLazyProducts = (lazy_products > std::numeric_limits<longUInt>::max()) ? std::numeric_limits<longUInt>::max() : static_cast<longUInt>(lazy_products);
+
 	log::out << log::info << "Using the Chinese Remainder Theorem (" << mAmount << " coprimes)" << log::endl;
 	for (longUInt i = 0; i < mAmount; ++i) {
 		log::out << " * coprime[" << i << "] = " << mPrimes[i] << log::endl;
@@ -29,6 +62,9 @@ epic::lint::ChineseRemainder::ChineseRemainder(const longUInt* primes, const siz
 
 epic::lint::ChineseRemainder::~ChineseRemainder() {
 	delete[] mFactors;
+	delete[] mInverses;
+	delete[] mInversesShoup;
+	delete[] mReciprocals;
 }
 
 epic::longUInt epic::lint::ChineseRemainder::getLargeNumberSize() {
@@ -77,12 +113,81 @@ void epic::lint::ChineseRemainder::plusEqual(LargeNumber& dest, const LargeNumbe
 	}
 }
 
+void epic::lint::ChineseRemainder::plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) {
+	for (longUInt k = 0; k < n; ++k) {
+		longUInt* d = dest[k].array;
+		const longUInt* o = op[k].array;
+
+		for (size_t i = 0; i < mAmount; ++i) {
+			longUInt sum = d[i] + o[i];
+			d[i] = (sum >= mPrimes[i]) ? sum - mPrimes[i] : sum;
+		}
+	}
+}
+
+void epic::lint::ChineseRemainder::plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) {
+	longUInt* d = dest.array;
+
+	// no headroom: a single compare and subtract per addition
+	if (mLazyAdditions == 1) {
+		for (longUInt k = 0; k < n; ++k) {
+			const longUInt* o = op[k * stride].array;
+
+			for (size_t i = 0; i < mAmount; ++i) {
+				longUInt sum = d[i] + o[i];
+				d[i] = (sum >= mPrimes[i]) ? sum - mPrimes[i] : sum;
+			}
+		}
+		return;
+	}
+
+	for (longUInt begin = 0; begin < n; begin += mLazyAdditions) {
+		longUInt end = std::min(n, begin + mLazyAdditions);
+
+		for (size_t i = 0; i < mAmount; ++i) {
+			longUInt sum = d[i];
+			for (longUInt k = begin; k < end; ++k) {
+				sum += op[k * stride].array[i];
+			}
+			d[i] = reduce(sum, i);
+		}
+	}
+}
+
+void epic::lint::ChineseRemainder::plusEqualConvolution(LargeNumber& dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) {
+	for (size_t i = 0; i < mAmount; ++i) {
+		unsigned __int128 sum = dest.array[i];
+
+		for (longUInt begin = 0; begin < n; begin += mLazyProducts) {
+			longUInt end = std::min(n, begin + mLazyProducts);
+			for (longUInt k = begin; k < end; ++k) {
+				sum += static_cast<unsigned __int128>(op1[k].array[i]) * op2[n - 1 - k].array[i];
+			}
+			sum %= mPrimes[i];
+		}
+
+		dest.array[i] = static_cast<longUInt>(sum);
+	}
+}
+
 void epic::lint::ChineseRemainder::minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) {
 	for (size_t i = 0; i < mAmount; ++i) {
 		dest.array[i] = (op1.array[i] >= op2.array[i]) ? op1.array[i] - op2.array[i] : mPrimes[i] + op1.array[i] - op2.array[i];
 	}
 }
 
+void epic::lint::ChineseRemainder::minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) {
+	for (longUInt k = 0; k < n; ++k) {
+		longUInt* d = dest[k].array;
+		const longUInt* o1 = op1[k].array;
+		const longUInt* o2 = op2[k].array;
+
+		for (size_t i = 0; i < mAmount; ++i) {
+			d[i] = (o1[i] >= o2[i]) ? o1[i] - o2[i] : mPrimes[i] + o1[i] - o2[i];
+		}
+	}
+}
+
 void epic::lint::ChineseRemainder::minusEqual(LargeNumber& dest, const LargeNumber& op) {
 	for (size_t i = 0; i < mAmount; ++i) {
 		if (dest.array[i] >= op.array[i]) {
@@ -147,6 +252,18 @@ void epic::lint::ChineseRemainder::assign_zero(LargeNumber& dest) {
 	}
 }
 
+void epic::lint::ChineseRemainder::assign(LargeNumber* dest, const LargeNumber* src, longUInt n) {
+	for (longUInt k = 0; k < n; ++k) {
+		std::copy(src[k].array, src[k].array + mAmount, dest[k].array);
+	}
+}
+
+void epic::lint::ChineseRemainder::assign_zero(LargeNumber* dest, longUInt n) {
+	for (longUInt k = 0; k < n; ++k) {
+		std::fill(dest[k].array, dest[k].array + mAmount, 0);
+	}
+}
+
 void epic::lint::ChineseRemainder::assign_one(LargeNumber& dest) {
 	for (size_t i = 0; i < mAmount; ++i) {
 		dest.array[i] = 1;
@@ -163,8 +280,57 @@ void epic::lint::ChineseRemainder::to_bigInt(bigInt* dest, const LargeNumber& va
 	*dest %= mM;
 }
 
+void epic::lint::ChineseRemainder::to_bigInt(bigInt* dest, const LargeNumber* value, longUInt n) {
+	std::vector<longUInt> digits(mAmount);
+
+	for (longUInt k = 0; k < n; ++k) {
+		mixedRadixDigits(digits.data(), value[k]);
+
+		mpz_set_ui(dest[k].get_mpz_t(), digits[mAmount - 1]);
+		for (size_t i = mAmount - 1; i > 0; --i) {
+			mpz_mul_ui(dest[k].get_mpz_t(), dest[k].get_mpz_t(), mPrimes[i - 1]);
+			mpz_add_ui(dest[k].get_mpz_t(), dest[k].get_mpz_t(), digits[i - 1]);
+		}
+	}
+}
+
+void epic::lint::ChineseRemainder::to_double(double* dest, const LargeNumber* value, longUInt n) {
+	std::vector<longUInt> digits(mAmount);
+
+	for (longUInt k = 0; k < n; ++k) {
+		mixedRadixDigits(digits.data(), value[k]);
+
+		double d = static_cast<double>(digits[mAmount - 1]);
+		for (size_t i = mAmount - 1; i > 0; --i) {
+			d = d * static_cast<double>(mPrimes[i - 1]) + static_cast<double>(digits[i - 1]);
+		}
+		dest[k] = d;
+	}
+}
+
+void epic::lint::ChineseRemainder::mixedRadixDigits(longUInt* digits, const LargeNumber& value) {
+	for (size_t i = 0; i < mAmount; ++i) {
+		longUInt digit = value.array[i];
+		for (size_t j = 0; j < i; ++j) {
+			longUInt dj = digits[j];
+			if (dj >= mPrimes[i]) {
+				dj %= mPrimes[i];
+			}
+			digit = (digit >= dj) ? digit - dj : digit + mPrimes[i] - dj;
+
+			// digit = digit * mInverses[i * mAmount + j] mod mPrimes[i]
+			longUInt quotient = static_cast<longUInt>((static_cast<unsigned __int128>(digit) * mInversesShoup[i * mAmount + j]) >> 64);
+			digit = digit * mInverses[i * mAmount + j] - quotient * mPrimes[i];
+			if (digit >= mPrimes[i]) {
+				digit -= mPrimes[i];
+			}
+		}
+		digits[i] = digit;
+	}
+}
+
 void epic::lint::ChineseRemainder::alloc_largeNumberArray(LargeNumber* array, longUInt number_of_elements) {
-	auto mem_pool = new longUInt[number_of_elements * mAmount];
+	auto mem_pool = MemoryTracker::new_array<longUInt>(number_of_elements * mAmount);
 
 	for (longUInt i = 0; i < number_of_elements; ++i) {
 		array[i].array = mem_pool + (i * mAmount);
@@ -172,7 +338,7 @@ void epic::lint::ChineseRemainder::alloc_largeNumberArray(LargeNumber* array, lo
 }
 
 void epic::lint::ChineseRemainder::allocInit_largeNumberArray(LargeNumber* array, longUInt number_of_elements) {
-	auto mem_pool = new longUInt[number_of_elements * mAmount]();
+	auto mem_pool = MemoryTracker::new_array<longUInt>(number_of_elements * mAmount, true);
 
 	for (longUInt i = 0; i < number_of_elements; ++i) {
 		array[i].array = mem_pool + (i * mAmount);
@@ -180,17 +346,17 @@ void epic::lint::ChineseRemainder::allocInit_largeNumberArray(LargeNumber* array
 }
 
 void epic::lint::ChineseRemainder::free_largeNumberArray(LargeNumber* array) {
-	delete[] array[0].array;
+	MemoryTracker::delete_array(array[0].array);
 }
 
 void epic::lint::ChineseRemainder::alloc_largeNumber(LargeNumber& big_number) {
-	big_number.array = new longUInt[mAmount];
+	big_number.array = MemoryTracker::new_array<longUInt>(mAmount);
 }
 
 void epic::lint::ChineseRemainder::allocInit_largeNumber(LargeNumber& big_number) {
-	big_number.array = new longUInt[mAmount]();
+	big_number.array = MemoryTracker::new_array<longUInt>(mAmount, true);
 }
 
 void epic::lint::ChineseRemainder::free_largeNumber(LargeNumber& big_number) {
-	delete[] big_number.array;
+	MemoryTracker::delete_array(big_number.array);
 }
@@ -35,7 +35,20 @@ public:
 	void plus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
 	void plusEqual(LargeNumber& dest, const longUInt& op) override;
 	void plusEqual(LargeNumber& dest, const LargeNumber& op) override;
+	void plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) override;
+
+	/**
+	 * @note The residues get added up lazily: Blocks of mLazyAdditions summands get added without a reduction, followed by a single reduction per block.
+	 */
+	void plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) override;
+
+	/**
+	 * @note The products of the residues get accumulated in 128 bit integers and only get reduced every mLazyProducts products.
+	 */
+	void plusEqualConvolution(LargeNumber& dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) override;
+
 	void minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
+	void minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) override;
 	void minusEqual(LargeNumber& dest, const LargeNumber& op) override;
 	void mul(LargeNumber& dest, const LargeNumber& op1, const longUInt& op2) override;
 	void mul(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
@@ -44,6 +57,8 @@ public:
 	void assign(LargeNumber& dest, const LargeNumber& value) override;
 	void assign(LargeNumber& dest, const longUInt& value) override;
 	void assign_zero(LargeNumber& dest) override;
+	void assign(LargeNumber* dest, const LargeNumber* src, longUInt n) override;
+	void assign_zero(LargeNumber* dest, longUInt n) override;
 	void assign_one(LargeNumber& dest) override;
 
 	/**
@@ -58,6 +73,16 @@ public:
 	 */
 	void to_bigInt(bigInt* dest, const LargeNumber& value) override;
 
+	/**
+	 * @note In contrast to to_bigInt() for a single value, this method does not need any bigInt multiplication or modulo operation: The mixed radix digits (see to_double()) get evaluated using multiplications by single primes only.
+	 */
+	void to_bigInt(bigInt* dest, const LargeNumber* value, longUInt n) override;
+
+	/**
+	 * @note In contrast to to_bigInt() this method does not need any bigInt arithmetic: The mixed radix digits (Garner's algorithm) get calculated modulo the primes and only the final evaluation of the mixed radix representation is done using doubles.
+	 */
+	void to_double(double* dest, const LargeNumber* value, longUInt n) override;
+
 	void alloc_largeNumberArray(LargeNumber* array, longUInt number_of_elements) override;
 	void allocInit_largeNumberArray(LargeNumber* array, longUInt number_of_elements) override;
 	void free_largeNumberArray(LargeNumber* array) override;
@@ -67,10 +92,39 @@ public:
 	void free_largeNumber(LargeNumber& big_number) override;
 
 private:
+	/**
+	 * Calculating the mixed radix digits of a value (Garner's algorithm): value = digits[0] + digits[1] * p0 + digits[2] * p0 * p1 + ...
+	 *
+	 * @param digits Return array of mAmount elements
+	 * @param value The value to convert
+	 */
+	void mixedRadixDigits(longUInt* digits, const LargeNumber& value);
+
+	/**
+	 * Reducing an unreduced sum of residues without a division
+	 *
+	 * @param value The value to reduce
+	 * @param i The index of the prime
+	 * @return value mod mPrimes[i]
+	 */
+	inline longUInt reduce(longUInt value, size_t i) const {
+		longUInt quotient = static_cast<longUInt>((static_cast<unsigned __int128>(value) * mReciprocals[i]) >> 64); // the exact quotient or at most 2 less
+		value -= quotient * mPrimes[i];
+		while (value >= mPrimes[i]) {
+			value -= mPrimes[i];
+		}
+		return value;
+	}
+
 	const longUInt* mPrimes; // An pointer to the first element of an array of primes (co-primes) with at least mAmount entries
 	const size_t mAmount;	 // The number of used primes
 	const bigInt mM;		 // The product of all used primes
 	bigInt* mFactors;		 // An array to precalculated (at construction time) factors later needed for the conversion back to a bigInt object. mFactors[i] = Mi * Mi_inverse (Mi: the product of all primes except prime[i]: mM / mPrimes[i]; Mi_inverse: the modulo inverse element of mPrimes[i] mod mM)
+	longUInt* mInverses;	 // An array of precalculated (at construction time) modulo inverse elements needed by the to_double() conversion. mInverses[i * mAmount + j] = mPrimes[j]^-1 mod mPrimes[i] (for j < i)
+	longUInt* mInversesShoup; // mInversesShoup[k] = floor(mInverses[k] * 2^64 / mPrimes[i]): allows multiplying by mInverses[k] modulo mPrimes[i] without a division (Shoup's method)
+	longUInt* mReciprocals;	  // mReciprocals[i] = floor((2^64 - 1) / mPrimes[i]): allows reducing a longUInt modulo mPrimes[i] without a division (see reduce())
+	longUInt mLazyAdditions;  // The number of residues that can get added to a reduced residue without overflowing a longUInt (at least 1, depends on the headroom of the largest prime, see PrimeCalculatorAddition)
+	longUInt mLazyProducts;	  // The number of products of residues that can get added to a reduced residue without overflowing an unsigned __int128
 };
 
 } /* namespace epic::lint */
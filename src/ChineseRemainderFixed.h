@@ -0,0 +1,233 @@
+#ifndef EPIC_LINT_CHINESEREMAINDERFIXED_H_
+#define EPIC_LINT_CHINESEREMAINDERFIXED_H_
+
+#include "ChineseRemainder.h"
+#include "ItfPrimeCalculator.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace epic::lint {
+
+/**
+ * A ChineseRemainder implementation for a number of primes known at compile time.
+ *
+ * The primes are the first NPrimes precalculated primes of PrimeCalculator (PrimeCalculatorAddition or PrimeCalculatorMultiplication), i.e. the same primes the generic ChineseRemainder gets passed for NPrimes primes. Since they are compile time constants, the loops over the residues get fully unrolled (see forEachPrime()) and the compiler replaces each modulo operation by a multiplication and a shift.
+ *
+ * Only the arithmetic operations get overridden, the allocation and the conversions are the ones of ChineseRemainder.
+ *
+ * @tparam NPrimes The number of primes
+ * @tparam PrimeCalculator The prime calculator providing the precalculated primes (at least NPrimes of them)
+ */
+template<size_t NPrimes, class PrimeCalculator> class ChineseRemainderFixed final : public ChineseRemainder {
+public:
+	/**
+	 * Constructing a ChineseRemainderFixed object
+	 *
+	 * @param m The product of the NPrimes primes
+	 */
+	explicit ChineseRemainderFixed(const bigInt& m)
+		: ChineseRemainder(cPrimes.array, NPrimes, m) {}
+
+	void increment(LargeNumber& dest) override {
+		forEachPrime([&](auto i) {
+			constexpr longUInt p = cPrimes.array[i];
+			++dest.array[i];
+			if (dest.array[i] >= p) {
+				dest.array[i] -= p;
+			}
+		});
+	}
+
+	void plus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override {
+		forEachPrime([&](auto i) {
+			constexpr longUInt p = cPrimes.array[i];
+			longUInt sum = op1.array[i] + op2.array[i];
+			dest.array[i] = (sum >= p) ? sum - p : sum;
+		});
+	}
+
+	void plusEqual(LargeNumber& dest, const longUInt& op) override {
+		forEachPrime([&](auto i) {
+			constexpr longUInt p = cPrimes.array[i];
+			longUInt sum = dest.array[i] + ((op >= p) ? op % p : op);
+			dest.array[i] = (sum >= p) ? sum - p : sum;
+		});
+	}
+
+	void plusEqual(LargeNumber& dest, const LargeNumber& op) override {
+		add(dest.array, op.array);
+	}
+
+	void plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) override {
+		for (longUInt k = 0; k < n; ++k) {
+			add(dest[k].array, op[k].array);
+		}
+	}
+
+	void plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) override {
+		if constexpr (cLazyAdditions == 1) {
+			for (longUInt k = 0; k < n; ++k) {
+				add(dest.array, op[k * stride].array);
+			}
+		} else {
+			// blocks of cLazyAdditions summands without a reduction (see ChineseRemainder::plusEqualSum())
+			for (longUInt begin = 0; begin < n; begin += cLazyAdditions) {
+				longUInt end = std::min(n, begin + cLazyAdditions);
+				longUInt sum[NPrimes];
+				std::copy(dest.array, dest.array + NPrimes, sum);
+
+				for (longUInt k = begin; k < end; ++k) {
+					const longUInt* o = op[k * stride].array;
+					forEachPrime([&](auto i) {
+						sum[i] += o[i];
+					});
+				}
+
+				forEachPrime([&](auto i) {
+					constexpr longUInt p = cPrimes.array[i];
+					dest.array[i] = sum[i] % p;
+				});
+			}
+		}
+	}
+
+	void plusEqualConvolution(LargeNumber& dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) override {
+		unsigned __int128 sum[NPrimes];
+		std::copy(dest.array, dest.array + NPrimes, sum);
+
+		// blocks of cLazyProducts products without a reduction (see ChineseRemainder::plusEqualConvolution())
+		for (longUInt begin = 0; begin < n; begin += cLazyProducts) {
+			longUInt end = std::min(n, begin + cLazyProducts);
+
+			for (longUInt k = begin; k < end; ++k) {
+				const longUInt* o1 = op1[k].array;
+				const longUInt* o2 = op2[n - 1 - k].array;
+				forEachPrime([&](auto i) {
+					sum[i] += static_cast<unsigned __int128>(o1[i]) * o2[i];
+				});
+			}
+
+			forEachPrime([&](auto i) {
+				constexpr longUInt p = cPrimes.array[i];
+				sum[i] %= p;
+			});
+		}
+
+		forEachPrime([&](auto i) {
+			dest.array[i] = static_cast<longUInt>(sum[i]);
+		});
+	}
+
+	void minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override {
+		sub(dest.array, op1.array, op2.array);
+	}
+
+	void minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) override {
+		for (longUInt k = 0; k < n; ++k) {
+			sub(dest[k].array, op1[k].array, op2[k].array);
+		}
+	}
+
+	void minusEqual(LargeNumber& dest, const LargeNumber& op) override {
+		sub(dest.array, dest.array, op.array);
+	}
+
+	void mul(LargeNumber& dest, const LargeNumber& op1, const longUInt& op2) override {
+		forEachPrime([&](auto i) {
+			constexpr longUInt p = cPrimes.array[i];
+			dest.array[i] = (op1.array[i] * ((op2 >= p) ? op2 % p : op2)) % p;
+		});
+	}
+
+	void mul(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override {
+		forEachPrime([&](auto i) {
+			constexpr longUInt p = cPrimes.array[i];
+			dest.array[i] = (op1.array[i] * op2.array[i]) % p;
+		});
+	}
+
+	void mulEqual(LargeNumber& dest, const LargeNumber& op) override {
+		mul(dest, dest, op);
+	}
+
+	void assign(LargeNumber& dest, const LargeNumber& value) override {
+		std::copy(value.array, value.array + NPrimes, dest.array);
+	}
+
+	void assign(LargeNumber& dest, const longUInt& value) override {
+		forEachPrime([&](auto i) {
+			constexpr longUInt p = cPrimes.array[i];
+			dest.array[i] = (value >= p) ? value % p : value;
+		});
+	}
+
+	void assign_zero(LargeNumber& dest) override {
+		std::fill(dest.array, dest.array + NPrimes, 0);
+	}
+
+	void assign(LargeNumber* dest, const LargeNumber* src, longUInt n) override {
+		for (longUInt k = 0; k < n; ++k) {
+			std::copy(src[k].array, src[k].array + NPrimes, dest[k].array);
+		}
+	}
+
+	void assign_zero(LargeNumber* dest, longUInt n) override {
+		for (longUInt k = 0; k < n; ++k) {
+			std::fill(dest[k].array, dest[k].array + NPrimes, 0);
+		}
+	}
+
+	void assign_one(LargeNumber& dest) override {
+		std::fill(dest.array, dest.array + NPrimes, 1);
+	}
+
+private:
+	/**
+	 * Calling func(std::integral_constant<size_t, i>()) for each i in [0, NPrimes), i.e. the index is a compile time constant inside func.
+	 */
+	template<class Func> static inline void forEachPrime(Func&& func) {
+		forEachPrime(func, std::make_index_sequence<NPrimes>());
+	}
+
+	template<class Func, size_t... I> static inline void forEachPrime(Func& func, std::index_sequence<I...>) {
+		(func(std::integral_constant<size_t, I>()), ...);
+	}
+
+	// dest = dest + op (residue-wise)
+	static inline void add(longUInt* dest, const longUInt* op) {
+		forEachPrime([&](auto i) {
+			constexpr longUInt p = cPrimes.array[i];
+			longUInt sum = dest[i] + op[i];
+			dest[i] = (sum >= p) ? sum - p : sum;
+		});
+	}
+
+	// dest = op1 - op2 (residue-wise)
+	static inline void sub(longUInt* dest, const longUInt* op1, const longUInt* op2) {
+		forEachPrime([&](auto i) {
+			constexpr longUInt p = cPrimes.array[i];
+			dest[i] = (op1[i] >= op2[i]) ? op1[i] - op2[i] : p + op1[i] - op2[i];
+		});
+	}
+
+	static constexpr StaticArray<longUInt, NPrimes> cPrimes = PrimeCalculator::template getPrecalculatedPrimes<NPrimes>();
+
+	static constexpr longUInt maxPrime() {
+		longUInt ret = 0;
+		for (size_t i = 0; i < NPrimes; ++i) {
+			ret = std::max(ret, cPrimes.array[i]);
+		}
+		return ret;
+	}
+
+	// the headroom for lazy reductions (see ChineseRemainder::mLazyAdditions and ChineseRemainder::mLazyProducts)
+	static constexpr longUInt cLazyAdditions = std::numeric_limits<longUInt>::max() / (maxPrime() - 1) - 1;
+	static constexpr unsigned __int128 cMaxLazyProducts = ~static_cast<unsigned __int128>(0) / (static_cast<unsigned __int128>(maxPrime() - 1) * (maxPrime() - 1)) - 1;
+	static constexpr longUInt cLazyProducts = (cMaxLazyProducts > std::numeric_limits<longUInt>::max()) ? std::numeric_limits<longUInt>::max() : static_cast<longUInt>(cMaxLazyProducts);
+};
+
+} /* namespace epic::lint */
+
+#endif /* EPIC_LINT_CHINESEREMAINDERFIXED_H_ */
@@ -24,7 +24,7 @@ std::vector<epic::bigFloat> epic::index::ColemanCollective::calculate(Game* g) {
 	{
 		bigInt big_total_wc;
 		gCalculator->to_bigInt(&big_total_wc, total_wc);
-    	bigInt output =  big_total_wc * (bigInt(1) << g->getNumberOfPlayersWithWeight0());
+    	bigInt output =  big_total_wc * coalitionsOfPlayersWithWeight0(g);
 		log::out << log::info << "Total number of winning coalitions: " << output.get_str() << log::endl;
 
 		//total number of winning coalitions / maximal number of winning coalitions(= 2^g->getNumberOfNonZeroPlayers())
@@ -33,7 +33,7 @@ std::vector<epic::bigFloat> epic::index::ColemanInitiative::calculate(Game* g) {
 		bigInt sp;
 
 		if (log::out.getLogLevel() <= log::info) {
-			bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0();
+			bigInt factor = coalitionsOfPlayersWithWeight0(g);
       		bigInt output =  big_total_wc * factor;
 			log::out << log::info << "Total number of winning coalitions: " << output.get_str() << log::endl;
 			log::out << log::info << "Number of times each player is a swing player:" << log::endl;
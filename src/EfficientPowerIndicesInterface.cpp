@@ -37,7 +37,7 @@ void handleWeightsFromFile(const std::string& weightsfile, std::vector<epic::lon
 
 
 // [[Rcpp::export]]
-std::vector<std::string> ComputePowerIndexAdapter(Rcpp::String index, Rcpp::Nullable<Rcpp::NumericVector> weights, double quota, Rcpp::String weightsfile, Rcpp::Nullable<Rcpp::List> precoalitions, bool filterNullPlayers = false, bool verbose = false, bool weightedMajorityGame = false, bool inputFloatWeights = false) {
+std::vector<std::string> ComputePowerIndexAdapter(Rcpp::String index, Rcpp::Nullable<Rcpp::NumericVector> weights, double quota, Rcpp::String weightsfile, Rcpp::Nullable<Rcpp::List> precoalitions, bool filterNullPlayers = false, bool verbose = false, bool weightedMajorityGame = false, bool inputFloatWeights = false, double memoryLimit = 0, int threads = 1, bool fastMode = false, double fastModeTolerance = 1e-12) {
   std::string s_index = crs(index);
 
 	if (!epic::index::IndexFactory::validateIndex(s_index)){
@@ -141,8 +141,20 @@ std::vector<std::string> ComputePowerIndexAdapter(Rcpp::String index, Rcpp::Null
 	  v_quota = v_quota + 1;
 	} 
 	
+	if (memoryLimit < 0 || memoryLimit != std::floor(memoryLimit)) {
+	  Rcpp::stop("The memory limit needs to be an integer larger than 0 (or 0 for no limit).");
+	}
+	
+	if (threads < 0) {
+	  Rcpp::stop("The number of threads needs to be at least 1 (or 0 for all hardware threads).");
+	}
+	
+	if (fastModeTolerance <= 0) {
+	  Rcpp::stop("The tolerance of the fast mode needs to be larger than 0.");
+	}
+	
 	// pass the arguments to the UserInputHandler
-	epic::io::UserInputHandler userInputHandler(s_index, v_weights, v_quota, v_precoalitions, epic::io::OutputType::R, filterNullPlayers, verbose);
+	epic::io::UserInputHandler userInputHandler(s_index, v_weights, v_quota, v_precoalitions, epic::io::OutputType::R, filterNullPlayers, verbose, static_cast<epic::longUInt>(memoryLimit), static_cast<epic::longUInt>(threads), fastMode, fastModeTolerance);
 	
 	std::vector<std::string> results;
 	results.clear();
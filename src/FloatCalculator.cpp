@@ -0,0 +1,15 @@
+#include "FloatCalculator.h"
+
+epic::lint::FloatCalculator::FloatCalculator()
+	: mRelativeErrorBound(0) {}
+
+double epic::lint::FloatCalculator::getRelativeErrorBound() const {
+	return mRelativeErrorBound.load(std::memory_order_relaxed);
+}
+
+void epic::lint::FloatCalculator::updateRelativeErrorBound(double bound) {
+	double current = mRelativeErrorBound.load(std::memory_order_relaxed);
+	while (current < bound && !mRelativeErrorBound.compare_exchange_weak(current, bound, std::memory_order_relaxed)) {
+		// current got reloaded, try again
+	}
+}
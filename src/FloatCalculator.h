@@ -0,0 +1,38 @@
+#ifndef EPIC_LINT_FLOATCALCULATOR_H_
+#define EPIC_LINT_FLOATCALCULATOR_H_
+
+#include "ItfLargeNumberCalculator.h"
+
+#include <atomic>
+
+namespace epic::lint {
+
+/**
+ * The base of the floating-point calculators (see ScaledFloatCalculator)
+ *
+ * In contrast to the other calculators the values are not exact. Each LargeNumber carries a rigorous bound on its absolute error which gets updated by each operation (running error analysis). The relative error bound of each value leaving the calculator (see to_bigInt() and to_double()) gets accumulated: After the calculation getRelativeErrorBound() bounds the relative error of every value converted. If it is too large, the calculation needs to get repeated using an exact calculator (see GlobalCalculator::getRelativeErrorBound()).
+ */
+class FloatCalculator : public ItfLargeNumberCalculator {
+public:
+	FloatCalculator();
+
+	/**
+	 * @return The maximum relative error bound of all values converted since the construction of this object (0 if all of them are exact, infinity if the error bound of a value does not exclude 0 or a value overflowed)
+	 */
+	double getRelativeErrorBound() const;
+
+protected:
+	/**
+	 * Raising the relative error bound (see getRelativeErrorBound()) to bound if it is smaller. Thread-safe.
+	 *
+	 * @param bound The relative error bound of a converted value
+	 */
+	void updateRelativeErrorBound(double bound);
+
+private:
+	std::atomic<double> mRelativeErrorBound;
+};
+
+} /* namespace epic::lint */
+
+#endif /* EPIC_LINT_FLOATCALCULATOR_H_ */
@@ -44,6 +44,14 @@ epic::Game::Game(longUInt quota, const std::vector<longUInt>& weights, bool flag
 			mPlayerIsVetoPlayer[i] = false;
 		}
 	}
+
+	// Find out which players are member of every winning coalition (the heaviest ones)
+	mNumberOfPlayersInEveryWinningCoalition = 0;
+	mReducedQuota = mQuota;
+	while (mNumberOfPlayersInEveryWinningCoalition < mNumberOfNonZeroPlayers && mWeightSum - mWeights[mNumberOfPlayersInEveryWinningCoalition] < mQuota) {
+		mReducedQuota -= std::min(mReducedQuota, mWeights[mNumberOfPlayersInEveryWinningCoalition]);
+		++mNumberOfPlayersInEveryWinningCoalition;
+	}
 }
 
 const epic::Permutation& epic::Game::getPermutation() const {
@@ -92,6 +100,29 @@ void epic::Game::setSingleValueSolution(const bigFloat& value) {
 	mSolution[0] = value;
 }
 
+epic::longUInt epic::Game::getNumberOfPlayersInEveryWinningCoalition() const {
+	return mNumberOfPlayersInEveryWinningCoalition;
+}
+
+epic::longUInt epic::Game::getReducedQuota() const {
+	return mReducedQuota;
+}
+
+epic::bigInt epic::Game::getMaxNumberOfCoalitionWeights() const {
+	// k players of the same weight w reach the k + 1 weights 0, w, ..., k * w
+	bigInt ret = 1;
+	longUInt k = 0;
+	while (k < mWeights.size() && mWeights[k] > 0) {
+		longUInt m = 1;
+		while (k + m < mWeights.size() && mWeights[k + m] == mWeights[k]) {
+			++m;
+		}
+		ret *= m + 1;
+		k += m;
+	}
+	return ret;
+}
+
 epic::longUInt epic::Game::getNumberOfNullPlayers() const {
 	return mNumberOfNullPlayers;
 }
@@ -157,16 +188,47 @@ epic::longUInt epic::Game::findNullPlayersFromBelow(bool flag_withoutNullPlayers
 		}
 	}
 
-	auto cv = new longUInt[mQuota]();
+	/*
+	 * cv[x - 1]: number of coalitions of weight x (dense)
+	 *
+	 * If the weights are large compared to the number of players (e.g. population counts), only a few weights are reachable and an array over all weights up to the quota would not even fit into the memory. In that case only the reachable weights in [1, quota - 1] get stored (sparse). If even those are too many, the largest losing weight gets searched for by meet in the middle (halves).
+	 */
+	bool sparse = getMaxNumberOfCoalitionWeights() < mQuota;
+	bool halves = !sparse && mWeights.size() <= cMaxPlayersMeetInTheMiddle && ((bigInt(1) << (n / 2)) + (bigInt(1) << (n - n / 2))) * 4 <= mQuota;
+	auto cv = new longUInt[(sparse || halves) ? 0 : mQuota]();
+	std::vector<longUInt> reachable, merged;
 	longUInt alpha_iM1 = 0;
 
 	for (int i = 0; i < n && !nullPlayerIndexFound; i++) {
-		for (longUInt x = upper[i] + 1; x > mWeights[i]; x--) {
-			if (mWeights[i] != 0) {
-				if (x - 1 - mWeights[i] == 0) {
-					cv[x - 2] += 1;
-				} else {
-					cv[x - 2] += cv[(x - 2) - mWeights[i]];
+		if (sparse) {
+			if (mWeights[i] != 0 && mWeights[i] < mQuota) {
+				// reachable + {0} merged with (reachable + {0}) shifted by the weight of player i
+				merged.clear();
+				longUInt k = 0;
+				for (longUInt shifted = 0; shifted <= reachable.size(); ++shifted) {
+					longUInt x = mWeights[i] + ((shifted == 0) ? 0 : reachable[shifted - 1]);
+					if (x >= mQuota) {
+						break;
+					}
+					while (k < reachable.size() && reachable[k] < x) {
+						merged.push_back(reachable[k++]);
+					}
+					if (k < reachable.size() && reachable[k] == x) {
+						++k;
+					}
+					merged.push_back(x);
+				}
+				merged.insert(merged.end(), reachable.begin() + k, reachable.end());
+				std::swap(reachable, merged);
+			}
+		} else if (!halves) {
+			for (longUInt x = upper[i] + 1; x > mWeights[i]; x--) {
+				if (mWeights[i] != 0) {
+					if (x - 1 - mWeights[i] == 0) {
+						cv[x - 2] += 1;
+					} else {
+						cv[x - 2] += cv[(x - 2) - mWeights[i]];
+					}
 				}
 			}
 		}
@@ -177,10 +239,21 @@ epic::longUInt epic::Game::findNullPlayersFromBelow(bool flag_withoutNullPlayers
 			}
 		}
 
-		for (longUInt j = mQuota - 2; j < mQuota; --j) {
-			if (cv[j] > 0) {
-				alpha_iM1 = j + 1;
-				break;
+		if (sparse) {
+			if (!reachable.empty()) {
+				alpha_iM1 = reachable.back();
+			}
+		} else if (halves) {
+			// only needed by the check of the next player
+			if (i + 1 > minsize) {
+				alpha_iM1 = findMaxLosingWeight(i + 1);
+			}
+		} else {
+			for (longUInt j = mQuota - 2; j < mQuota; --j) {
+				if (cv[j] > 0) {
+					alpha_iM1 = j + 1;
+					break;
+				}
 			}
 		}
 		w_sum -= mWeights[i];
@@ -209,6 +282,45 @@ epic::longUInt epic::Game::findNullPlayersFromBelow(bool flag_withoutNullPlayers
 	}
 }
 
+epic::longUInt epic::Game::findMaxLosingWeight(longUInt players) const {
+	// the weights (less than the quota) of all coalitions of the players [begin, end) in increasing order
+	auto listCoalitions = [this](longUInt begin, longUInt end) {
+		std::vector<longUInt> sums(1, 0), merged;
+		for (longUInt j = begin; j < end; ++j) {
+			merged.clear();
+			longUInt a = 0;
+			longUInt b = 0;
+			while (a < sums.size() || (b < sums.size() && sums[b] + mWeights[j] < mQuota)) {
+				if (a < sums.size() && (b == sums.size() || sums[b] + mWeights[j] >= mQuota || sums[a] <= sums[b] + mWeights[j])) {
+					merged.push_back(sums[a++]);
+				} else {
+					merged.push_back(sums[b++] + mWeights[j]);
+				}
+			}
+			std::swap(sums, merged);
+		}
+		return sums;
+	};
+
+	std::vector<longUInt> sums_a = listCoalitions(0, players / 2);
+	std::vector<longUInt> sums_b = listCoalitions(players / 2, players);
+
+	// p: the number of weights of the second half which fit below the quota together with the current weight of the first half
+	longUInt alpha = 0;
+	longUInt p = sums_b.size();
+	for (longUInt a : sums_a) {
+		while (p > 0 && a + sums_b[p - 1] >= mQuota) {
+			--p;
+		}
+		if (p == 0) {
+			break;
+		}
+		alpha = std::max(alpha, a + sums_b[p - 1]);
+	}
+
+	return alpha;
+}
+
 /*
  *
  * ##########################
@@ -247,11 +359,11 @@ void epic::PrecoalitionGame::sortPrecoalitions() {
 	}
 }
 
-std::vector<std::vector<int>> epic::PrecoalitionGame::getPrecoalitions() const {
+const std::vector<std::vector<int>>& epic::PrecoalitionGame::getPrecoalitions() const {
 	return mPrecoalitions;
 }
 
-std::vector<epic::longUInt> epic::PrecoalitionGame::getPrecoalitionWeights() const {
+const std::vector<epic::longUInt>& epic::PrecoalitionGame::getPrecoalitionWeights() const {
 	return mPrecoalitionWeights;
 }
 
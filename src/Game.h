@@ -220,6 +220,29 @@ public:
 	 */
 	longUInt getNumberOfVetoPlayers() const;
 
+	/**
+	 * A function to get the number of players that are member of every winning coalition, i.e. the players i with weightsum - w_i < quota
+	 *
+	 * Due to the decreasing order of the weights those are the players 0, ..., v - 1. Since every winning coalition contains all of them, the winning coalitions correspond to the ones of the reduced game of the players v, ..., n - 1 with the quota getReducedQuota().
+	 *
+	 * @return The amount of players that are member of every winning coalition (v)
+	 */
+	longUInt getNumberOfPlayersInEveryWinningCoalition() const;
+
+	/**
+	 * A function to get the quota of the reduced game (see getNumberOfPlayersInEveryWinningCoalition())
+	 *
+	 * @return The quota minus the weights of the players 0, ..., v - 1 (0 if those players reach the quota on their own)
+	 */
+	longUInt getReducedQuota() const;
+
+	/**
+	 * A function to get an upper bound for the number of different weights the coalitions of the players can reach
+	 *
+	 * @return The product of m_w + 1 over all different non-zero weights w (m_w: the number of players of weight w)
+	 */
+	bigInt getMaxNumberOfCoalitionWeights() const;
+
 	/**
 	 * A function to get the number of null players (including the players of weight zero)
 	 *
@@ -269,6 +292,10 @@ private:
 
 	longUInt mNumberOfVetoPlayers; // Total amount of veto players
 
+	longUInt mNumberOfPlayersInEveryWinningCoalition; // Total amount of players that are member of every winning coalition
+
+	longUInt mReducedQuota; // The quota minus the weights of the players that are member of every winning coalition
+
 	longUInt mNumberOfNullPlayers; // Total amount of null players (including those of weight zero)
 
 	longUInt mNumberOfNonZeroPlayers; // Total amount of players of weight greater than zero
@@ -292,6 +319,21 @@ private:
 	 */
 	longUInt findNullPlayersFromBelow(bool flag_withoutNullPlayers);
 
+	/**
+	 * Finding the largest weight less than the quota a coalition of the players 0, ..., players - 1 can reach (meet in the middle)
+	 *
+	 * The weights of all coalitions of each half of the players get listed in increasing order. Sweeping one list upwards and the other one downwards finds the largest sum of two weights below the quota.
+	 *
+	 * @param players The number of (heaviest) players to consider
+	 * @return The largest weight less than the quota (0 if there is none besides the empty coalition)
+	 */
+	longUInt findMaxLosingWeight(longUInt players) const;
+
+	/**
+	 * The maximum number of players findMaxLosingWeight() gets used for (see findNullPlayersFromBelow())
+	 */
+	static constexpr longUInt cMaxPlayersMeetInTheMiddle = 48;
+
 protected:
 	std::vector<longUInt> mWeights; // The player's weights
 
@@ -317,7 +359,7 @@ public:
 	/**
 	 * A function to get the precoalition structure (2d vector, as passed to the constructor but updated to match the sorted weights of getWeights()-function)
 	 */
-	std::vector<std::vector<int>> getPrecoalitions() const;
+	const std::vector<std::vector<int>>& getPrecoalitions() const;
 
 	/**
 	 * Get a vector of precoalition weights.
@@ -326,7 +368,7 @@ public:
 	 *
 	 * @return The vector of the precoalition weights
 	 */
-	std::vector<longUInt> getPrecoalitionWeights() const;
+	const std::vector<longUInt>& getPrecoalitionWeights() const;
 
 	/**
 	 * Get the number of precoalitions
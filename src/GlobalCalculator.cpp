@@ -1,15 +1,28 @@
 #include "GlobalCalculator.h"
 
+#include "CheckedUIntCalculator.h"
+#include "FloatCalculator.h"
+
 #include <functional>
 
 epic::lint::ItfLargeNumberCalculator* epic::gCalculator = nullptr;
 
-void epic::lint::GlobalCalculator::init(const CalculatorConfig& config) {
+void epic::lint::GlobalCalculator::init(const CalculatorConfig& config, bool try_uint) {
 	if (gCalculator != nullptr) {
 		throw std::bad_function_call(); // "The global Calculator-object is already initialized!"
 	}
 
-	gCalculator = ItfLargeNumberCalculator::new_calculator(config);
+	gCalculator = ItfLargeNumberCalculator::new_calculator(config, try_uint);
+}
+
+bool epic::lint::GlobalCalculator::hasOverflowed() {
+	auto checked_calculator = dynamic_cast<CheckedUIntCalculator*>(gCalculator);
+	return checked_calculator != nullptr && checked_calculator->hasOverflowed();
+}
+
+double epic::lint::GlobalCalculator::getRelativeErrorBound() {
+	auto float_calculator = dynamic_cast<FloatCalculator*>(gCalculator);
+	return (float_calculator != nullptr) ? float_calculator->getRelativeErrorBound() : 0;
 }
 
 void epic::lint::GlobalCalculator::remove() {
@@ -22,10 +22,25 @@ public:
 		 * Initialize the gCalculator object based on the passed CalculatorConfig
 		 *
 		 * @param config The configuration for the gCalculator
+		 * @param try_uint Try to do the calculation using single integers first (see ItfLargeNumberCalculator::new_calculator()). If set, hasOverflowed() must be checked after the calculation.
 		 *
 		 * @note If gCalculator is already initialized, i.e. gCalculator != nullptr, a bad_function_call exception gets thrown.
 		 */
-	static void init(const CalculatorConfig& config);
+	static void init(const CalculatorConfig& config, bool try_uint = false);
+
+	/**
+		 * Checking if the result of the calculation done using gCalculator is invalid due to an overflow
+		 *
+		 * @return true if gCalculator is a CheckedUIntCalculator that detected an overflow. In that case the calculation must get repeated after initializing gCalculator without try_uint.
+		 */
+	static bool hasOverflowed();
+
+	/**
+		 * Getting the bound on the relative error of the values converted from gCalculator
+		 *
+		 * @return The relative error bound if gCalculator is a FloatCalculator (see FloatCalculator::getRelativeErrorBound()), 0 for the exact calculators. If it is too large, the calculation must get repeated after initializing gCalculator with an exact int representation.
+		 */
+	static double getRelativeErrorBound();
 
 	/**
 		 * Delete the gCalculator object
@@ -87,6 +87,27 @@ epic::HardwareInfo::HardwareInfo() {
 			}
 		}
 	}
+
+	{ // L2 cache size
+		mCacheSize = 0;
+
+		// the caches of cpu0: index0, index1, ... (one of them is the level 2 data or unified cache)
+		for (int index = 0; index < 8 && mCacheSize == 0; ++index) {
+			const std::string dir_name = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+			std::ifstream level_file(dir_name + "level");
+			std::ifstream type_file(dir_name + "type");
+			std::ifstream size_file(dir_name + "size");
+
+			int level = 0;
+			std::string type, size;
+			if (level_file >> level && type_file >> type && size_file >> size && level == 2 && type != "Instruction") {
+				mCacheSize = static_cast<longUInt>(doubleInString(size)); // e.g. "2048K"
+				if (size.back() == 'M') {
+					mCacheSize *= 1024;
+				}
+			}
+		}
+	}
 }
 
 #elif defined(__APPLE__)
@@ -162,6 +183,19 @@ epic::HardwareInfo::HardwareInfo() {
 			mCpuFrequency = 0;
 		}
 	}
+
+	// L2 cache size
+	{
+		unsigned long long size;
+		size_t length = sizeof(size);
+
+		if (sysctlbyname("hw.l2cachesize", &size, &length, NULL, 0) == -1) {
+			// error
+			mCacheSize = 0;
+		} else {
+			mCacheSize = size / cMemUnit_factor;
+		}
+	}
 }
 
 #elif defined(__WIN32__) || defined(__CYGWIN__)
@@ -170,6 +204,7 @@ epic::HardwareInfo::HardwareInfo() {
  */
 
 #include <iostream>
+#include <vector>
 #include <windows.h>
 
 epic::HardwareInfo::HardwareInfo() {
@@ -204,6 +239,23 @@ epic::HardwareInfo::HardwareInfo() {
 			mCpuFrequency = 0;
 		}
 	}
+
+	{ // L2 cache size
+		mCacheSize = 0;
+
+		DWORD length = 0;
+		GetLogicalProcessorInformation(NULL, &length);
+		std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+
+		if (!info.empty() && GetLogicalProcessorInformation(info.data(), &length)) {
+			for (auto& entry : info) {
+				if (entry.Relationship == RelationCache && entry.Cache.Level == 2 && entry.Cache.Type != CacheInstruction) {
+					mCacheSize = entry.Cache.Size / cMemUnit_factor;
+					break;
+				}
+			}
+		}
+	}
 }
 
 #else
@@ -215,6 +267,7 @@ epic::HardwareInfo::HardwareInfo() {
 	mRamSizeTotal = 0;
 	mRamSizeFree = 0;
 	mCpuFrequency = 0;
+	mCacheSize = 0;
 }
 
 #endif
@@ -230,3 +283,7 @@ epic::longUInt epic::HardwareInfo::getFreeRamSize() const {
 epic::longUInt epic::HardwareInfo::getCPUFrequency() const {
 	return mCpuFrequency;
 }
+
+epic::longUInt epic::HardwareInfo::getCacheSize() const {
+	return mCacheSize;
+}
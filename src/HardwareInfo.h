@@ -27,10 +27,16 @@ public:
 	 */
 	longUInt getCPUFrequency() const;
 
+	/**
+	 * @return The size of the level 2 data cache of a single core in <cMemUnit_name>. If the value is zero either the OS gets not supported or an error occurred at construction time while reading the value from the system.
+	 */
+	longUInt getCacheSize() const;
+
 private:
 	longUInt mRamSizeTotal;
 	longUInt mRamSizeFree;
 	longUInt mCpuFrequency;
+	longUInt mCacheSize;
 };
 
 } /* namespace epic */
@@ -108,6 +108,12 @@ const std::map<epic::index::IndexFactory::IndexType, std::pair<std::string, std:
 	{WM, {"WM", "Number of minimal winning coalitions"}},
 	{WS, {"WS", "Number of minimal winning coalitions of smallest cardinality"}}};
 
+const std::map<epic::index::IndexFactory::IndexType, epic::index::IndexFactory::IndexType> epic::index::IndexFactory::cBelowFormulations = {
+	{BZ, BZB},
+	{RBZ, RBZB},
+	{SH, SHB},
+	{RSH, RSHB}};
+
 bool epic::index::IndexFactory::validateIndex(const std::string& short_name) {
 	return getIndexType(short_name) != INVALID_INDEX;
 }
@@ -173,6 +179,33 @@ epic::index::ItfPowerIndex* epic::index::IndexFactory::new_powerIndex(const std:
 	return index;
 }
 
+std::string epic::index::IndexFactory::selectFormulation(const std::string& short_name, Game* g) {
+	IndexType type = getIndexType(short_name);
+	IndexType above = INVALID_INDEX;
+	IndexType below = INVALID_INDEX;
+
+	for (const auto& it : cBelowFormulations) {
+		if (it.first == type || it.second == type) {
+			above = it.first;
+			below = it.second;
+		}
+	}
+
+	if (above == INVALID_INDEX) {
+		return short_name;
+	}
+
+	// number of weights the tables of each formulation cover (the formulations from below run on the reduced game, see Game::getReducedQuota())
+	longUInt size_above = g->getWeightSum() + 1 - g->getQuota();
+	longUInt size_below = g->getReducedQuota();
+
+	if (size_above == size_below) {
+		return short_name;
+	}
+
+	return cIndexNames.at(size_below < size_above ? below : above).first;
+}
+
 void epic::index::IndexFactory::delete_powerIndex(ItfPowerIndex* index) {
 	delete index;
 }
@@ -32,6 +32,18 @@ public:
 	 */
 	static ItfPowerIndex* new_powerIndex(const std::string& short_name, Game* g, IntRepresentation int_representation = DEFAULT);
 
+	/**
+	 * Choosing the formulation of an index that needs the smaller tables
+	 *
+	 * Some indices come in two formulations counting the same swings either over the winning coalitions (weights [quota, weightsum], e.g. BZ, SH) or over the losing coalitions (weights [0, quota - 1], e.g. BZB, SHB). Both give the same results, but their tables (and therefore their memory requirement and running time) scale with weightsum + 1 - quota or the reduced quota (see Game::getReducedQuota()) respectively.
+	 *
+	 * @param short_name the index name abbreviation requested by the user
+	 * @param g an instance of mGame
+	 *
+	 * @return The abbreviation of the formulation to create using new_powerIndex(). If the index has no second formulation or if both tables have the same size, short_name gets returned.
+	 */
+	static std::string selectFormulation(const std::string& short_name, Game* g);
+
 	/**
 	 * Delete a powerindex instance
 	 *
@@ -119,6 +131,11 @@ private:
 	 * Maps each IndexTypes to a pair of abbreviation and full name
 	 */
 	static const std::map<IndexType, std::pair<std::string, std::string>> cIndexNames;
+
+	/**
+	 * Maps each index counting over the winning coalitions to its formulation counting over the losing coalitions (see selectFormulation())
+	 */
+	static const std::map<IndexType, IndexType> cBelowFormulations;
 };
 
 } // namespace epic::index
@@ -1,13 +1,35 @@
 #include "ItfLargeNumberCalculator.h"
 
 #include "BigIntCalculator.h"
+#include "CheckedUIntCalculator.h"
 #include "ChineseRemainder.h"
+#include "ChineseRemainderFixed.h"
 #include "ItfPrimeCalculator.h"
 #include "PrimeCalculatorAddition.h"
 #include "PrimeCalculatorMultiplication.h"
+#include "ScaledFloatCalculator.h"
 #include "UIntCalculator.h"
 
-epic::lint::ItfLargeNumberCalculator* epic::lint::ItfLargeNumberCalculator::new_calculator(const CalculatorConfig& config) {
+/*
+ * creates a ChineseRemainderFixed object if the number of primes is in [2, n_primes], a generic ChineseRemainder object otherwise
+ *
+ * @tparam PrimeCalculator The prime calculator (or PrimeCalculatorAddition::Headroom) which provided the primes
+ * @tparam n_primes The largest number of primes to create a ChineseRemainderFixed object for
+ * @param pInfo The primes to use
+ * @return The new calculator object
+ */
+template<class PrimeCalculator, size_t n_primes = 8> epic::lint::ItfLargeNumberCalculator* new_chineseRemainder(const epic::lint::PrimesInfo& pInfo) {
+	if constexpr (n_primes < 2) {
+		return new epic::lint::ChineseRemainder(pInfo.primesArray, pInfo.primesAmount, pInfo.maxValue);
+	} else {
+		if (pInfo.primesAmount == n_primes) {
+			return new epic::lint::ChineseRemainderFixed<n_primes, PrimeCalculator>(pInfo.maxValue);
+		}
+		return new_chineseRemainder<PrimeCalculator, n_primes - 1>(pInfo);
+	}
+}
+
+epic::lint::ItfLargeNumberCalculator* epic::lint::ItfLargeNumberCalculator::new_calculator(const CalculatorConfig& config, bool try_uint) {
 	ItfLargeNumberCalculator* ret;
 
 	ItfPrimeCalculator* calculator;
@@ -20,10 +42,22 @@ epic::lint::ItfLargeNumberCalculator* epic::lint::ItfLargeNumberCalculator::new_
 	PrimesInfo pInfo = calculator->getPrimes(config.maxValue);
 	if (pInfo.primesAmount == 1) {
 		ret = new UIntCalculator();
-	} else if ((config.intRep == DEFAULT && pInfo.primesAmount > 4) || config.intRep == GMP) {
-		ret = new BigIntCalculator();
-	} else { // if ((int_representation == DEFAULT && pInfo.primesAmount <= 4) || int_representation == PRIMES)
-		ret = new ChineseRemainder(pInfo.primesArray, pInfo.primesAmount, pInfo.maxValue);
+	} else if (config.intRep == FLOAT && ScaledFloatCalculator<double>::isApplicable(config.maxValue)) {
+		ret = new ScaledFloatCalculator<double>(config.maxValue);
+	} else if (config.intRep == FLOAT && ScaledFloatCalculator<long double>::isApplicable(config.maxValue)) {
+		ret = new ScaledFloatCalculator<long double>(config.maxValue);
+	} else if (try_uint && (config.intRep == DEFAULT || config.intRep == FLOAT)) {
+		ret = new CheckedUIntCalculator();
+	} else if (((config.intRep == DEFAULT || config.intRep == FLOAT) && pInfo.primesAmount > 4) || config.intRep == GMP) {
+		ret = new BigIntCalculator(config.maxValue);
+	} else { // if (((int_representation == DEFAULT || int_representation == FLOAT) && pInfo.primesAmount <= 4) || int_representation == PRIMES)
+		if (config.op == Operation::multiplication) {
+			ret = new_chineseRemainder<PrimeCalculatorMultiplication>(pInfo);
+		} else if (pInfo.headroom) { // the primes leaving headroom (see PrimeCalculatorAddition)
+			ret = new_chineseRemainder<PrimeCalculatorAddition::Headroom>(pInfo);
+		} else {
+			ret = new_chineseRemainder<PrimeCalculatorAddition>(pInfo);
+		}
 	}
 
 	delete calculator;
@@ -31,6 +65,62 @@ epic::lint::ItfLargeNumberCalculator* epic::lint::ItfLargeNumberCalculator::new_
 	return ret;
 }
 
+void epic::lint::ItfLargeNumberCalculator::plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		plusEqual(dest[i], op[i]);
+	}
+}
+
+void epic::lint::ItfLargeNumberCalculator::plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) {
+	for (longUInt i = 0; i < n; ++i) {
+		plusEqual(dest, op[i * stride]);
+	}
+}
+
+void epic::lint::ItfLargeNumberCalculator::plusEqualConvolution(LargeNumber& dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) {
+	LargeNumber tmp;
+	alloc_largeNumber(tmp);
+
+	for (longUInt i = 0; i < n; ++i) {
+		mul(tmp, op1[i], op2[n - 1 - i]);
+		plusEqual(dest, tmp);
+	}
+
+	free_largeNumber(tmp);
+}
+
+void epic::lint::ItfLargeNumberCalculator::minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		minus(dest[i], op1[i], op2[i]);
+	}
+}
+
+void epic::lint::ItfLargeNumberCalculator::assign(LargeNumber* dest, const LargeNumber* src, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		assign(dest[i], src[i]);
+	}
+}
+
+void epic::lint::ItfLargeNumberCalculator::assign_zero(LargeNumber* dest, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		assign_zero(dest[i]);
+	}
+}
+
+void epic::lint::ItfLargeNumberCalculator::to_bigInt(bigInt* dest, const LargeNumber* value, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		to_bigInt(&dest[i], value[i]);
+	}
+}
+
+void epic::lint::ItfLargeNumberCalculator::to_double(double* dest, const LargeNumber* value, longUInt n) {
+	bigInt tmp;
+	for (longUInt i = 0; i < n; ++i) {
+		to_bigInt(&tmp, value[i]);
+		dest[i] = tmp.get_d();
+	}
+}
+
 void epic::lint::ItfLargeNumberCalculator::delete_calculator(ItfLargeNumberCalculator* calculator) {
 	delete calculator;
 }
@@ -96,6 +96,47 @@ public:
 	 */
 	virtual void plusEqual(LargeNumber& dest, const LargeNumber& op) = 0;
 
+	/**
+	 * Applying the addition equal operator to each element of a span of LargeNumber objects
+	 *
+	 * dest[i] += op[i] for i = 0, ..., n - 1
+	 *
+	 * In contrast to calling plusEqual() for each element, the implementation can process the whole span without a dispatch per element.
+	 *
+	 * @param dest The first element of the span of sums (and first operands)
+	 * @param op The first element of the span of second operands
+	 * @param n The number of elements
+	 *
+	 * @note The elements get processed in ascending order. Therefore the spans may overlap if op lies behind dest (op > dest): Each op[i] gets read before it gets modified, e.g. plusEqual(&a[0], &a[w], n) adds the old value of a[i + w] to a[i]. The spans must not overlap if op lies in front of dest.
+	 */
+	virtual void plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n);
+
+	/**
+	 * Adding up a span of LargeNumber objects
+	 *
+	 * dest += op[0] + op[stride] + ... + op[(n - 1) * stride]
+	 *
+	 * @param dest The sum (and first summand)
+	 * @param op The first summand of the span
+	 * @param n The number of summands in the span
+	 * @param stride The distance between two consecutive summands, e.g. the row length to add up a column of a two-dimensional array
+	 */
+	virtual void plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride = 1);
+
+	/**
+	 * Adding up the products of two spans of LargeNumber objects, the second one in reverse order (multiply-accumulate)
+	 *
+	 * dest += op1[0] * op2[n - 1] + op1[1] * op2[n - 2] + ... + op1[n - 1] * op2[0]
+	 *
+	 * This is the term of a convolution, e.g. the number of coalitions of a given weight consisting of a part from a forward table and a part from a backward table.
+	 *
+	 * @param dest The sum (and first summand)
+	 * @param op1 The first element of the first span of factors
+	 * @param op2 The first element of the second span of factors
+	 * @param n The number of products
+	 */
+	virtual void plusEqualConvolution(LargeNumber& dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n);
+
 	/**
 	 * Applying the subtraction operator according to the chinese lint theorem
 	 *
@@ -107,6 +148,20 @@ public:
 	 */
 	virtual void minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) = 0;
 
+	/**
+	 * Applying the subtraction operator to each element of a span of LargeNumber objects
+	 *
+	 * dest[i] = op1[i] - op2[i] for i = 0, ..., n - 1
+	 *
+	 * @param dest The first element of the span of differences
+	 * @param op1 The first element of the span of first operands
+	 * @param op2 The first element of the span of second operands
+	 * @param n The number of elements
+	 *
+	 * @note dest may be equal to op1 or op2, but the spans must not overlap partially. A recursion like a[k] = b[k] - a[k + w] has to get split into blocks of at most w elements, each block referring to the already calculated one.
+	 */
+	virtual void minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n);
+
 	/**
 	 * Applying the subtraction equal operator according to the chinese lint theorem
 	 *
@@ -177,6 +232,27 @@ public:
 	 */
 	virtual void assign_zero(LargeNumber& dest) = 0;
 
+	/**
+	 * Copying a span of LargeNumber objects
+	 *
+	 * dest[i] = src[i] for i = 0, ..., n - 1
+	 *
+	 * @param dest The first element of the span of assignment targets
+	 * @param src The first element of the span of assignment values
+	 * @param n The number of elements
+	 *
+	 * @note The spans must not overlap.
+	 */
+	virtual void assign(LargeNumber* dest, const LargeNumber* src, longUInt n);
+
+	/**
+	 * Assigning the constant c=0 to each element of a span of LargeNumber objects
+	 *
+	 * @param dest The first element of the span of assignment targets
+	 * @param n The number of elements
+	 */
+	virtual void assign_zero(LargeNumber* dest, longUInt n);
+
 	/**
 	 * Assigning the constant c=1 to the largeNumber dest
 	 *
@@ -197,6 +273,32 @@ public:
 	 */
 	virtual void to_bigInt(bigInt* dest, const LargeNumber& value) = 0;
 
+	/**
+	 * Converting a span of LargeNumber objects to bigInt objects
+	 *
+	 * dest[i] = value[i] for i = 0, ..., n - 1
+	 *
+	 * The implementation can share the work of all conversions (e.g. the temporaries of ChineseRemainder).
+	 *
+	 * @param dest The first element of the conversion targets
+	 * @param value The first element of the span of values to convert
+	 * @param n The number of elements
+	 */
+	virtual void to_bigInt(bigInt* dest, const LargeNumber* value, longUInt n);
+
+	/**
+	 * Converting a span of LargeNumber objects to (rounded) double values
+	 *
+	 * dest[i] = value[i] for i = 0, ..., n - 1
+	 *
+	 * In contrast to calling to_bigInt() and bigInt::get_d() for each element, the implementation can convert the values directly without a temporary bigInt object.
+	 *
+	 * @param dest The first element of the conversion targets
+	 * @param value The first element of the span of values to convert
+	 * @param n The number of elements
+	 */
+	virtual void to_double(double* dest, const LargeNumber* value, longUInt n);
+
 	/**
 	 * Getting the number represented by val as string.
 	 *
@@ -268,12 +370,15 @@ public:
 	 * Depending on the required configuration the correct object gets created.
 	 *
 	 * @param config The configuration specifying the requirements on the ItfLargeNumberCalculator object
+	 * @param try_uint If true, config.intRep is DEFAULT and a single integer variable is not enough to represent config.maxValue, a CheckedUIntCalculator gets created instead. In that case the caller must check for an overflow after the calculation (CheckedUIntCalculator::hasOverflowed()) and repeat it if necessary.
+	 *
+	 * If config.intRep is FLOAT and a single integer variable is not enough, a ScaledFloatCalculator (double or, for larger values, long double) gets created. In that case the caller must check the error bound after the calculation (FloatCalculator::getRelativeErrorBound()) and repeat it using an exact calculator if necessary. If the range of both floating-point types is too small, FLOAT gets treated like DEFAULT.
 	 *
 	 * @return A new allocated object of type ItfLargeNumberCalculator is able to represent at least config.maxValue and calculate the config.op operations.
 	 *
 	 * @note The returned object should be deleted using delete_calculator() function.
 	 */
-	static ItfLargeNumberCalculator* new_calculator(const CalculatorConfig& config);
+	static ItfLargeNumberCalculator* new_calculator(const CalculatorConfig& config, bool try_uint = false);
 
 	/**
 	 * A Factory-Method deleting an object of type ItfLargeNumberCalculator
@@ -0,0 +1,5 @@
+#include "ItfPowerIndex.h"
+
+epic::bigInt epic::index::ItfPowerIndex::coalitionsOfPlayersWithWeight0(Game* g) {
+	return bigInt(1) << g->getNumberOfPlayersWithWeight0();
+}
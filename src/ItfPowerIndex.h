@@ -49,6 +49,41 @@ public:
 	virtual lint::Operation getOperationRequirement() = 0;
 	
 protected:
+	/**
+	 * Getting the number of coalitions the players of weight 0 can form (2^z for z players of weight 0)
+	 *
+	 * Players of weight 0 never change whether a coalition is winning. Therefore each coalition counted without them stands for this many coalitions of the complete game.
+	 */
+	static bigInt coalitionsOfPlayersWithWeight0(Game* g);
+
+	/**
+	 * Folding the players of weight 0 into the weights of a summation over the cardinality axis
+	 *
+	 * A coalition of cardinality c counted without the z players of weight 0 stands for C(z, j) coalitions of cardinality c + j of the complete game. Instead of running the dynamic programs with those players included (or shifting the resulting tables once per player of weight 0), the tables get calculated for the non-zero players only and a final summation sum_p n(p) * h(p) over the cardinalities p of the complete game becomes sum_c n(c) * H(c) with
+	 *
+	 * H(c) = sum_{j = 0}^{z} C(z, j) * h(c + j)
+	 *
+	 * @param h The weights per cardinality of the complete game (h[p]: weight of cardinality p)
+	 * @param z The number of players of weight 0
+	 * @return The weights per cardinality of the non-zero players (h.size() - z elements)
+	 */
+	template<typename T>
+	static std::vector<T> cardinalityWeightsWithPlayersOfWeight0(const std::vector<T>& h, longUInt z) {
+		std::vector<T> ret(h.size() - z);
+		bigInt binomial = 1;
+
+		for (longUInt j = 0; j <= z; ++j) {
+			T factor = binomial; // C(z, j)
+			for (longUInt c = 0; c < ret.size(); ++c) {
+				ret[c] += factor * h[c + j];
+			}
+
+			binomial *= z - j;
+			binomial /= j + 1;
+		}
+
+		return ret;
+	}
 }; /* ItfPowerIndex */
 
 } /* namespace epic::index */
@@ -15,11 +15,13 @@ namespace epic::lint {
  * A Structure containing the basic Primes information
  * 
  * It contains the primes and their amount as well as the largest representable number + 1 which is the product over all primes
+ * and whether the primes are taken from the table leaving headroom (see PrimeCalculatorAddition::Headroom)
  */
 struct PrimesInfo {
 	const longUInt* primesArray;
 	const size_t primesAmount;
 	const bigInt maxValue;
+	const bool headroom = false;
 };
 
 /**
@@ -8,7 +8,7 @@ namespace epic::lint {
 /**
  * Storing the values representing a large integer number (the representation depends on the used ItfLargeNumberCalculator)
  *
- * This union can only be used in combination of an ItfLargeNumberCalculator object. Depending on that object either the uint, array or bint member get used.
+ * This union can only be used in combination of an ItfLargeNumberCalculator object. Depending on that object either the uint, array or limbs member get used.
  * First of all the union must be initialized using the ItfLargeNumberCalculator::alloc_largeNumber() or ItfLargeNumberCalculator::allocInit_largeNumber() method. After allocation/initialization  different mathematical operations can get applied to the ChineseNumber object using the ItfLargeNumberCalculator methods (e.g. assign(), plus(), plusEqual(), etc.). After usage the object must be freed using the ItfLargeNumberCalculator::free_largeNumber() method.
  *
  * @note ALL operations to a LargeNumber object must get applied using one single instance of ItfLargeNumberCalculator.
@@ -17,7 +17,9 @@ namespace epic::lint {
 union LargeNumber {
 	longUInt uint;	 // single integer: used if no primes (chinese remainder theorem) is needed to represent the value
 	longUInt* array; // an array of integers (same number as the primes) representing a big number
-	bigInt* bint;	 // pointer to an BigInt object (needed to save memory for very large problems since bigInt only allocates as much memory as it needs)
+	mp_limb_t* limbs; // a fixed-size array of GMP limbs representing a big number (used by the BigIntCalculator)
+	double* reals; // a scaled floating-point value and its error bound (used by the ScaledFloatCalculator<double>)
+	long double* long_reals; // the same using long double (used by the ScaledFloatCalculator<long double>)
 };
 
 } /* namespace epic::lint */
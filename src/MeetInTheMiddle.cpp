@@ -0,0 +1,184 @@
+#include "MeetInTheMiddle.h"
+
+#include "GlobalCalculator.h"
+#include "Logging.h"
+#include "Parallel.h"
+#include "SparseCoalitions.h"
+
+#include <algorithm>
+#include <bitset>
+
+bool epic::index::MeetInTheMiddle::isPreferable(Game* g, bigInt dense_size) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+	if (n == 0 || n > cMaxPlayers) {
+		return false;
+	}
+
+	// the number of coalitions of both halves
+	bigInt size = (bigInt(1) << (n / 2)) + (bigInt(1) << (n - n / 2));
+
+	// the sparse coalition tables need fewer weights (e.g. many players of equal weight)
+	if (SparseCoalitions::getCapacity(g, g->getQuota()) <= size) {
+		return false;
+	}
+
+	return size * cMinDenseFactor <= dense_size;
+}
+
+void epic::index::MeetInTheMiddle::swingsPerPlayer(Game* g, lint::LargeNumber n_sp[]) {
+	std::vector<longUInt> swings;
+	countSwings(g, 1, swings);
+
+	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+		gCalculator->assign(n_sp[i], swings[i]);
+	}
+}
+
+void epic::index::MeetInTheMiddle::swingsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& raw_ssi) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+
+	// the cardinalities 0, ..., n - 1 suffice: the only coalition of cardinality n is the grand coalition which is winning
+	std::vector<longUInt> swings;
+	countSwings(g, n, swings);
+
+	// a coalition of cardinality c not containing i turns into a winning coalition of cardinality c + 1
+	for (longUInt i = 0; i < n; ++i) {
+		for (longUInt c = 0; c < n; ++c) {
+			gCalculator->assign(raw_ssi(i, c + 1), swings[i * n + c]);
+		}
+	}
+}
+
+epic::bigInt epic::index::MeetInTheMiddle::getMemoryRequirement(Game* g, longUInt rows) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+
+	// both halves: sums and members, plus the merge buffers of listCoalitions()
+	bigInt memory = ((bigInt(1) << (n / 2)) + (bigInt(1) << (n - n / 2))) * (c_sizeof_longUInt + sizeof(std::uint32_t)) * 2;
+	memory += bigInt(n) * rows * c_sizeof_longUInt; // swings
+	return memory;
+}
+
+void epic::index::MeetInTheMiddle::listCoalitions(const longUInt* weights, longUInt n, longUInt max_weight, std::vector<longUInt>& sums, std::vector<std::uint32_t>& members) {
+	sums.clear();
+	members.clear();
+	if (max_weight == 0) {
+		return;
+	}
+
+	sums.reserve(longUInt(1) << n);
+	members.reserve(longUInt(1) << n);
+	sums.push_back(0);
+	members.push_back(0);
+
+	std::vector<longUInt> merge_sums;
+	std::vector<std::uint32_t> merge_members;
+	merge_sums.reserve(longUInt(1) << n);
+	merge_members.reserve(longUInt(1) << n);
+
+	for (longUInt j = 0; j < n; ++j) {
+		longUInt w = weights[j];
+		std::uint32_t bit = std::uint32_t(1) << j;
+
+		/*
+		 * Merging the coalitions without player j (a) and the ones with player j (b: the same weights shifted by w, as long as they stay below the maximum weight)
+		 */
+		merge_sums.clear();
+		merge_members.clear();
+		longUInt a = 0;
+		longUInt b = 0;
+		longUInt size = sums.size();
+		while (a < size || (b < size && sums[b] + w < max_weight)) {
+			if (a < size && (b == size || sums[b] + w >= max_weight || sums[a] <= sums[b] + w)) {
+				merge_sums.push_back(sums[a]);
+				merge_members.push_back(members[a]);
+				++a;
+			} else {
+				merge_sums.push_back(sums[b] + w);
+				merge_members.push_back(members[b] | bit);
+				++b;
+			}
+		}
+
+		std::swap(sums, merge_sums);
+		std::swap(members, merge_members);
+	}
+}
+
+void epic::index::MeetInTheMiddle::countSwings(Game* g, longUInt rows, std::vector<longUInt>& swings) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+	longUInt n_a = n / 2;
+	longUInt n_b = n - n_a;
+	longUInt quota = g->getQuota();
+	const std::vector<longUInt>& weights = g->getWeights();
+
+	log::out << log::info << "Using meet in the middle (" << n_a << " + " << n_b << " players)" << log::endl;
+
+	// only the losing coalitions (weight less than the quota) can turn winning
+	std::vector<longUInt> sums_a, sums_b;
+	std::vector<std::uint32_t> members_a, members_b;
+	listCoalitions(weights.data(), n_a, quota, sums_a, members_a);
+	listCoalitions(weights.data() + n_a, n_b, quota, sums_b, members_b);
+
+	// the cardinality of a coalition of a half (0 if the cardinalities get summed up)
+	auto cardinality = [rows](std::uint32_t members) -> longUInt {
+		return (rows > 1) ? std::bitset<32>(members).count() : 0;
+	};
+
+	swings.assign(n * rows, 0);
+	longUInt diff_size = (rows > 1) ? n_b + 1 : 1;
+	longUInt threads = Parallel::getNumberOfThreads(n, diff_size * c_sizeof_longUInt);
+
+	Parallel::for_each(n, threads, [&](longUInt, longUInt i) {
+		// players of the same weight have the same swings (copied below)
+		if (i > 0 && weights[i] == weights[i - 1]) {
+			return;
+		}
+
+		std::uint32_t skip_a = (i < n_a) ? std::uint32_t(1) << i : 0;
+		std::uint32_t skip_b = (i >= n_a) ? std::uint32_t(1) << (i - n_a) : 0;
+		longUInt lower = (quota > weights[i]) ? quota - weights[i] : 0;
+		longUInt* res = &swings[i * rows];
+
+		/*
+		 * [p_lower, p_upper): the coalitions of B whose weight is in [lower - w(S_A), quota - w(S_A))
+		 * diff[c]: the number of those coalitions of cardinality c not containing i
+		 */
+		std::vector<longUInt> diff(diff_size, 0);
+		longUInt p_upper = sums_b.size();
+		longUInt p_lower = sums_b.size();
+
+		for (longUInt k = 0; k < sums_a.size(); ++k) {
+			if (members_a[k] & skip_a) {
+				continue;
+			}
+
+			longUInt a = sums_a[k];
+			longUInt upper_b = quota - a;
+			longUInt lower_b = (lower > a) ? lower - a : 0;
+
+			while (p_upper > 0 && sums_b[p_upper - 1] >= upper_b) {
+				--p_upper;
+				if (!(members_b[p_upper] & skip_b)) {
+					--diff[cardinality(members_b[p_upper])];
+				}
+			}
+			while (p_lower > 0 && sums_b[p_lower - 1] >= lower_b) {
+				--p_lower;
+				if (!(members_b[p_lower] & skip_b)) {
+					++diff[cardinality(members_b[p_lower])];
+				}
+			}
+
+			longUInt c_a = cardinality(members_a[k]);
+			for (longUInt c_b = 0; c_b < diff_size && c_a + c_b < rows; ++c_b) {
+				res[c_a + c_b] += diff[c_b];
+			}
+		}
+	});
+
+	for (longUInt i = 1; i < n; ++i) {
+		if (weights[i] == weights[i - 1]) {
+			std::copy(&swings[(i - 1) * rows], &swings[i * rows], &swings[i * rows]);
+		}
+	}
+}
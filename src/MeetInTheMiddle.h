@@ -0,0 +1,94 @@
+#ifndef EPIC_INDEX_MEETINTHEMIDDLE_H_
+#define EPIC_INDEX_MEETINTHEMIDDLE_H_
+
+#include "Array.h"
+#include "Game.h"
+#include "LargeNumber.h"
+#include "types.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace epic::index {
+
+/**
+ * Counting the swings of games with a moderate number of players but a weight sum too large for the dense tables (meet in the middle).
+ *
+ * The non-zero players get split into the heavier half A (players 0, ..., nA - 1) and the lighter half B. The weights of all coalitions of each half get listed in increasing order together with their members. A coalition S = S_A + S_B not containing player i has a weight in [quota - wi, quota) iff the weight of S_B is in [quota - wi - w(S_A), quota - w(S_A)). Since the weights of S_A increase, both bounds decrease, i.e. two pointers sweeping B from the top count all those coalitions in a single pass over A and B per player.
+ *
+ * Each half has at most 2^24 coalitions (at most cMaxPlayers players), i.e. all counts fit into a longUInt and get converted into LargeNumbers at the end only.
+ */
+class MeetInTheMiddle {
+public:
+	MeetInTheMiddle() = delete;
+
+	/**
+	 * Checking whether the meet in the middle approach is preferable to a dense table
+	 *
+	 * Each pass over the halves touches about 2 * 2^(n / 2) coalition weights while the dense dynamic programs touch each weight of their tables. The halves get used if the game has at most cMaxPlayers non-zero players and the dense table is at least cMinDenseFactor times larger.
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param dense_size The number of weights the dense table would need
+	 */
+	static bool isPreferable(Game* g, bigInt dense_size);
+
+	/**
+	 * Calculating how often each non-zero player is a swing player (see RawBanzhaf)
+	 *
+	 * @param n_sp A return array. The array must be allocated at least in the range [0, g.getNumberOfNonZeroPlayers() - 1]!
+	 */
+	static void swingsPerPlayer(Game* g, lint::LargeNumber n_sp[]);
+
+	/**
+	 * Calculating how often each non-zero player is a swing player in coalitions of certain cardinalities (see RawShapleyShubik)
+	 *
+	 * @param raw_ssi A matrix where the calculated values will be stored. raw_ssi(x, y): amount of coalitions of cardinality y for which player x is a swing player. The matrix must be allocated and zero initialized in at least the range [0, numberOfNonZeroPlayers - 1] x [0, numberOfNonZeroPlayers].
+	 */
+	static void swingsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& raw_ssi);
+
+	/**
+	 * Getting the memory swingsPerPlayer() or swingsPerPlayerAndCardinality() needs (without the return arrays)
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param rows 1 for swingsPerPlayer(), the number of non-zero players for swingsPerPlayerAndCardinality()
+	 * @return The memory requirement in Bytes
+	 */
+	static bigInt getMemoryRequirement(Game* g, longUInt rows);
+
+private:
+	/**
+	 * The maximum number of non-zero players (at most 24 players per half, i.e. the members of a coalition fit into 32 bits)
+	 */
+	static constexpr longUInt cMaxPlayers = 48;
+
+	/**
+	 * The minimum factor the dense table must be larger than the coalitions of both halves (see isPreferable())
+	 */
+	static constexpr longUInt cMinDenseFactor = 4;
+
+	/**
+	 * Listing the weights of all coalitions of some players in increasing order
+	 *
+	 * Starting at the empty coalition, each player merges the list with a copy of itself shifted by the player's weight, i.e. the list gets sorted without any sorting pass. Only the weights less than max_weight get kept.
+	 *
+	 * @param weights The weights of the players
+	 * @param n The number of players (at most 32)
+	 * @param max_weight The upper bound of the weights to keep
+	 * @param sums Return vector: The coalition weights (increasing)
+	 * @param members Return vector: members[k] has bit j set iff player j belongs to the coalition of sums[k]
+	 */
+	static void listCoalitions(const longUInt* weights, longUInt n, longUInt max_weight, std::vector<longUInt>& sums, std::vector<std::uint32_t>& members);
+
+	/**
+	 * Counting the swings of all non-zero players
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param rows 1 to sum up all cardinalities, the number of non-zero players otherwise
+	 * @param swings Return vector: swings[i * rows + c] is the number of coalitions of cardinality c (not containing i) player i turns winning
+	 */
+	static void countSwings(Game* g, longUInt rows, std::vector<longUInt>& swings);
+};
+
+} /* namespace epic::index */
+
+#endif /* EPIC_INDEX_MEETINTHEMIDDLE_H_ */
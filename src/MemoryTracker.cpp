@@ -0,0 +1,113 @@
+#include "MemoryTracker.h"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+std::atomic<epic::longInt> epic::MemoryTracker::mCurrent(0);
+std::atomic<epic::longInt> epic::MemoryTracker::mPeak(0);
+std::atomic<epic::longUInt> epic::MemoryTracker::mLimit(0);
+std::atomic<epic::longInt> epic::MemoryTracker::mLimitBase(0);
+
+bool epic::MemoryTracker::mGMPTracking = false;
+
+void* (*epic::MemoryTracker::mPrevAllocate)(size_t) = nullptr;
+void* (*epic::MemoryTracker::mPrevReallocate)(void*, size_t, size_t) = nullptr;
+void (*epic::MemoryTracker::mPrevFree)(void*, size_t) = nullptr;
+
+void epic::MemoryTracker::setLimit(longUInt limit) {
+	mLimitBase = mCurrent.load();
+	mLimit = limit;
+}
+
+epic::longUInt epic::MemoryTracker::getLimit() {
+	return mLimit;
+}
+
+epic::longUInt epic::MemoryTracker::getCurrentUsage() {
+	longInt current = mCurrent;
+	return current > 0 ? current : 0;
+}
+
+epic::longUInt epic::MemoryTracker::getLimitedUsage() {
+	longInt usage = mCurrent - mLimitBase;
+	return usage > 0 ? usage : 0;
+}
+
+epic::longUInt epic::MemoryTracker::getPeakUsage() {
+	longInt peak = mPeak;
+	return peak > 0 ? peak : 0;
+}
+
+void epic::MemoryTracker::resetPeakUsage() {
+	mPeak = mCurrent.load();
+}
+
+void epic::MemoryTracker::startGMPTracking() {
+	if (!mGMPTracking) {
+		mp_get_memory_functions(&mPrevAllocate, &mPrevReallocate, &mPrevFree);
+		mp_set_memory_functions(gmp_allocate, gmp_reallocate, gmp_free);
+		mGMPTracking = true;
+	}
+}
+
+void epic::MemoryTracker::stopGMPTracking() {
+	if (mGMPTracking) {
+		mp_set_memory_functions(mPrevAllocate, mPrevReallocate, mPrevFree);
+		mGMPTracking = false;
+	}
+}
+
+void epic::MemoryTracker::reserve(longUInt bytes) {
+	longInt current = mCurrent.fetch_add(bytes) + bytes;
+
+	longUInt limit = mLimit;
+	longInt usage = current - mLimitBase;
+	if (limit > 0 && usage > 0 && static_cast<longUInt>(usage) > limit) {
+		mCurrent -= bytes;
+		throw std::runtime_error("Memory limit exceeded! (limit: " + std::to_string(limit / cMemUnit_factor) + " " + cMemUnit_name + ", needed: at least " + std::to_string(usage / cMemUnit_factor) + " " + cMemUnit_name + ")");
+	}
+
+	longInt peak = mPeak;
+	while (current > peak && !mPeak.compare_exchange_weak(peak, current)) {}
+}
+
+void epic::MemoryTracker::add(longUInt bytes) {
+	longInt current = mCurrent.fetch_add(bytes) + bytes;
+
+	longInt peak = mPeak;
+	while (current > peak && !mPeak.compare_exchange_weak(peak, current)) {}
+}
+
+void epic::MemoryTracker::release(longUInt bytes) {
+	mCurrent -= bytes;
+}
+
+void* epic::MemoryTracker::gmp_allocate(size_t size) {
+	void* ptr = std::malloc(size);
+	if (ptr == nullptr) {
+		std::abort(); // same behaviour as the GMP default allocation function
+	}
+
+	add(size);
+	return ptr;
+}
+
+void* epic::MemoryTracker::gmp_reallocate(void* ptr, size_t old_size, size_t new_size) {
+	void* new_ptr = std::realloc(ptr, new_size);
+	if (new_ptr == nullptr) {
+		std::abort(); // same behaviour as the GMP default reallocation function
+	}
+
+	if (new_size > old_size) {
+		add(new_size - old_size);
+	} else {
+		release(old_size - new_size);
+	}
+	return new_ptr;
+}
+
+void epic::MemoryTracker::gmp_free(void* ptr, size_t size) {
+	std::free(ptr);
+	release(size);
+}
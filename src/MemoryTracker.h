@@ -0,0 +1,169 @@
+#ifndef EPIC_MEMORYTRACKER_H_
+#define EPIC_MEMORYTRACKER_H_
+
+#include "types.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace epic {
+
+/**
+ * An accounting allocator keeping track of the memory used by the computation tables.
+ *
+ * All Array classes and the LargeNumber pools of the ItfLargeNumberCalculator implementations allocate their memory through this class. Each allocated block stores its size in a header in front of the array, so the current and the peak memory usage are known exactly at any time without a shared lookup table. While the GMP tracking is active (see startGMPTracking()), the limbs dynamically allocated by the GMP library get accounted as well.
+ *
+ * Optionally a memory limit can be set. A table allocation (new_array()) that would exceed this limit throws an exception instead of allocating the memory. The memory allocated by GMP counts for the current usage, but GMP allocations themselves are never refused (see gmp_allocate()).
+ *
+ * @note All methods are thread-safe.
+ */
+class MemoryTracker {
+public:
+	MemoryTracker() = delete;
+
+	/**
+	 * Allocating a C-style array of n elements of type T and accounting its size.
+	 *
+	 * @tparam T The array's content type
+	 * @param n The number of elements
+	 * @param value_initialize Defines whether the allocated values should be value initialized or not
+	 * @return The allocated array. It must be freed using delete_array()!
+	 *
+	 * @throws std::runtime_error If the allocation would exceed the memory limit (see setLimit())
+	 */
+	template<class T> static T* new_array(longUInt n, bool value_initialize = false) {
+		static_assert(std::is_trivially_destructible<T>::value, "delete_array() does not call destructors");
+		static_assert(alignof(T) <= cHeaderSize, "the header would misalign the array");
+
+		longUInt bytes = n * sizeof(T);
+		reserve(bytes);
+
+		char* block;
+		try {
+			block = static_cast<char*>(::operator new(cHeaderSize + bytes));
+		} catch (...) {
+			release(bytes);
+			throw;
+		}
+		*reinterpret_cast<longUInt*>(block) = bytes;
+
+		T* ptr = reinterpret_cast<T*>(block + cHeaderSize);
+		if (value_initialize) {
+			std::uninitialized_value_construct_n(ptr, n);
+		} else {
+			std::uninitialized_default_construct_n(ptr, n);
+		}
+		return ptr;
+	}
+
+	/**
+	 * Freeing an array previously allocated by new_array().
+	 *
+	 * @tparam T The array's content type
+	 * @param ptr The array to free. If ptr is a nullptr nothing happens.
+	 */
+	template<class T> static void delete_array(T* ptr) {
+		if (ptr != nullptr) {
+			char* block = reinterpret_cast<char*>(ptr) - cHeaderSize;
+			release(*reinterpret_cast<longUInt*>(block));
+			::operator delete(block);
+		}
+	}
+
+	/**
+	 * Setting the memory limit for the following calculation.
+	 *
+	 * The limit applies to the memory allocated after this call only. Memory still accounted from earlier calculations (e.g. tables an aborted calculation did not free) does not count towards it.
+	 *
+	 * @param limit The maximum number of bytes that may be allocated at the same time. It gets checked on each call of new_array(). If the limit is 0, no limit gets applied.
+	 */
+	static void setLimit(longUInt limit);
+
+	/**
+	 * @return The memory limit in Bytes (0 if no limit is set)
+	 */
+	static longUInt getLimit();
+
+	/**
+	 * @return The number of Bytes currently allocated through this class (and GMP, if the GMP tracking is active)
+	 */
+	static longUInt getCurrentUsage();
+
+	/**
+	 * @return The number of Bytes currently allocated since the last call of setLimit(), i.e. the usage the memory limit applies to
+	 */
+	static longUInt getLimitedUsage();
+
+	/**
+	 * @return The largest number of Bytes allocated at the same time since the last call of resetPeakUsage()
+	 */
+	static longUInt getPeakUsage();
+
+	/**
+	 * Setting the peak usage to the current usage.
+	 */
+	static void resetPeakUsage();
+
+	/**
+	 * Registering the accounting allocation functions at the GMP library (mp_set_memory_functions). From now on all memory allocated by GMP counts for the current usage.
+	 *
+	 * @note The previously registered functions get restored by stopGMPTracking(). The accounting functions use the same heap as the GMP default functions (malloc), therefore GMP objects can get freed independent of which functions were active at allocation time.
+	 */
+	static void startGMPTracking();
+
+	/**
+	 * Restoring the GMP memory functions that were active before the call to startGMPTracking().
+	 */
+	static void stopGMPTracking();
+
+private:
+	static std::atomic<longInt> mCurrent; // currently allocated Bytes (signed: GMP may free memory that was allocated before the tracking started)
+	static std::atomic<longInt> mPeak;	  // peak of mCurrent
+	static std::atomic<longUInt> mLimit;  // memory limit in Bytes (0: no limit)
+	static std::atomic<longInt> mLimitBase; // mCurrent at the last call of setLimit(): the limit applies to the Bytes allocated on top of it
+
+	/**
+	 * The size of the header in front of each array allocated via new_array(). It contains the size of the array in Bytes and keeps the array aligned like memory returned by operator new.
+	 */
+	static constexpr longUInt cHeaderSize = alignof(std::max_align_t);
+
+	static bool mGMPTracking; // true iff the accounting functions are registered at GMP
+
+	/**
+	 * Accounting the allocation of bytes Bytes.
+	 *
+	 * @throws std::runtime_error If the memory limit would be exceeded
+	 */
+	static void reserve(longUInt bytes);
+
+	/**
+	 * Accounting the allocation of bytes Bytes without checking the memory limit.
+	 */
+	static void add(longUInt bytes);
+
+	/**
+	 * Accounting the release of bytes Bytes.
+	 */
+	static void release(longUInt bytes);
+
+	/*
+	 * The accounting functions registered at GMP.
+	 *
+	 * @note GMP does not allow its allocation functions to return on failure. Therefore they do not throw on exceeding the memory limit but only account the memory. The limit gets enforced on the next table allocation.
+	 */
+	static void* gmp_allocate(size_t size);
+	static void* gmp_reallocate(void* ptr, size_t old_size, size_t new_size);
+	static void gmp_free(void* ptr, size_t size);
+
+	// the GMP memory functions active before startGMPTracking()
+	static void* (*mPrevAllocate)(size_t);
+	static void* (*mPrevReallocate)(void*, size_t, size_t);
+	static void (*mPrevFree)(void*, size_t);
+};
+
+} /* namespace epic */
+
+#endif /* EPIC_MEMORYTRACKER_H_ */
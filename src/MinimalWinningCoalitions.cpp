@@ -0,0 +1,286 @@
+#include "MinimalWinningCoalitions.h"
+
+#include "GlobalCalculator.h"
+
+#include <algorithm>
+
+template<bool Cardinality>
+epic::index::MinimalWinningCoalitions<Cardinality>::MinimalWinningCoalitions(Game* g, longUInt max_cardinality, bool backward)
+	: mGame(g), mQuota(g->getQuota()), mRows(Cardinality ? max_cardinality : 1), mBackward(backward), mPlayer(0) {
+	allocTables();
+
+	// Initialize the empty coalition with 1 since we know, that the empty coalition is always losing.
+	if (mRows > 0 && mQuota > 0) {
+		gCalculator->assign_one(mF(0, 0));
+	}
+
+	// f contains the players 0, ..., n - 2 (the first call of forEachPlayer() belongs to the last player)
+	for (longUInt i = 0; i + 1 < g->getNumberOfNonZeroPlayers(); ++i) {
+		addPlayer(i);
+	}
+}
+
+template<bool Cardinality>
+epic::index::MinimalWinningCoalitions<Cardinality>::MinimalWinningCoalitions(const MinimalWinningCoalitions& other)
+	: mGame(other.mGame), mQuota(other.mQuota), mRows(other.mRows), mBackward(other.mBackward), mPlayer(other.mPlayer) {
+	allocTables();
+
+	gCalculator->assign(mF.getArrayPointer(), other.mF.getArrayPointer(), mF.getNumberOfElements());
+	if (mBackward) {
+		gCalculator->assign(mB.getArrayPointer(), other.mB.getArrayPointer(), mB.getNumberOfElements());
+	}
+}
+
+template<bool Cardinality>
+epic::index::MinimalWinningCoalitions<Cardinality>::~MinimalWinningCoalitions() {
+	gCalculator->free_largeNumberArray(mF.getArrayPointer());
+	if (mBackward) {
+		gCalculator->free_largeNumberArray(mB.getArrayPointer());
+		gCalculator->free_largeNumberArray(mHelper.getArrayPointer());
+	}
+}
+
+template<bool Cardinality>
+epic::lint::LargeNumber* epic::index::MinimalWinningCoalitions<Cardinality>::getCoalitionsPerWeight(longUInt cardinality) {
+	return mF.getArray(cardinality);
+}
+
+template<>
+void epic::index::MinimalWinningCoalitions<false>::addMinimalWinningCoalitions(lint::LargeNumber& dest) {
+	// a veto player is only member of the minimal winning coalition {i}
+	if (mGame->getWeights()[mPlayer] >= mQuota) {
+		gCalculator->increment(dest);
+		return;
+	}
+
+	// sum_{x = 0}^{quota - 1} f[x] * b[quota - x]
+	gCalculator->plusEqualConvolution(dest, mF.getArray(0), &mB.getArray(0)[1], mQuota);
+}
+
+template<>
+void epic::index::MinimalWinningCoalitions<true>::addMinimalWinningCoalitions(lint::LargeNumber& dest, longUInt cardinality) {
+	if (mGame->getWeights()[mPlayer] >= mQuota) {
+		if (cardinality == 1) {
+			gCalculator->increment(dest);
+		}
+		return;
+	}
+
+	// |S'| = k and |T| = cardinality - k, where S' contains at most mPlayer players
+	longUInt k_min = (cardinality > mRows) ? cardinality - mRows : 0;
+	longUInt k_max = std::min({cardinality - 1, mRows - 1, mPlayer});
+	for (longUInt k = k_min; k <= k_max && cardinality > 0; ++k) {
+		gCalculator->plusEqualConvolution(dest, mF.getArray(k), &mB.getArray(cardinality - k - 1)[1], mQuota);
+	}
+}
+
+template<bool Cardinality>
+epic::bigInt epic::index::MinimalWinningCoalitions<Cardinality>::getMemoryRequirement(Game* g, longUInt max_cardinality, bool backward) {
+	longUInt rows = Cardinality ? max_cardinality : 1;
+	return getTableSize(g, rows, backward) * getNumberOfBlocks(g, rows, backward); // one set of tables per block
+}
+
+template<bool Cardinality>
+void epic::index::MinimalWinningCoalitions<Cardinality>::totalNumberOfMinimalWinningCoalitions(Game* g, bigInt* total_mwc) {
+	longUInt quota = g->getQuota();
+
+	// f[x]: coalitions of the players 0, ..., i - 1 with weight x
+	ArrayOffset<lint::LargeNumber> f(quota, 0);
+	gCalculator->allocInit_largeNumberArray(f.getArrayPointer(), quota);
+	gCalculator->assign_one(f[0]);
+
+	lint::LargeNumber tmp;
+	gCalculator->alloc_largeNumber(tmp);
+
+	bigInt big_tmp;
+	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+		longUInt wi = g->getWeights()[i];
+
+		if (wi < quota) {
+			// the minimal winning coalitions having player i as their lightest player
+			gCalculator->assign_zero(tmp);
+			gCalculator->plusEqualSum(tmp, &f[quota - wi], wi);
+			gCalculator->to_bigInt(&big_tmp, tmp);
+			*total_mwc += big_tmp;
+
+			addWeight(f.getArrayPointer(), quota, wi);
+		} else {
+			// a veto player is only member of the minimal winning coalition {i}
+			*total_mwc += 1;
+		}
+	}
+
+	gCalculator->free_largeNumber(tmp);
+	gCalculator->free_largeNumberArray(f.getArrayPointer());
+}
+
+template<bool Cardinality>
+epic::bigInt epic::index::MinimalWinningCoalitions<Cardinality>::getTableSize(Game* g, longUInt rows, bool backward) {
+	bigInt memory = bigInt(rows) * g->getQuota() * gCalculator->getLargeNumberSize(); // f
+	if (backward) {
+		memory += bigInt(rows) * (g->getQuota() + 1) * gCalculator->getLargeNumberSize(); // b
+		memory += bigInt(g->getQuota()) * gCalculator->getLargeNumberSize();			   // helper
+	}
+	return memory;
+}
+
+template<bool Cardinality>
+epic::longUInt epic::index::MinimalWinningCoalitions<Cardinality>::getNumberOfBlocks(Game* g, longUInt rows, bool backward) {
+	if (!backward) {
+		return 1;
+	}
+
+	bigInt table_size = getTableSize(g, rows, backward);
+	return table_size.fits_ulong_p() ? Parallel::getNumberOfThreads(g->getNumberOfNonZeroPlayers() / cMinPlayersPerBlock, table_size.get_ui()) : 1;
+}
+
+template<bool Cardinality>
+void epic::index::MinimalWinningCoalitions<Cardinality>::allocTables() {
+	mF.alloc(mRows, mQuota);
+	gCalculator->allocInit_largeNumberArray(mF.getArrayPointer(), mF.getNumberOfElements());
+
+	if (mBackward) {
+		mB.alloc(mRows, mQuota + 1);
+		gCalculator->allocInit_largeNumberArray(mB.getArrayPointer(), mB.getNumberOfElements());
+		mHelper.alloc(mQuota, 0);
+		gCalculator->alloc_largeNumberArray(mHelper.getArrayPointer(), mHelper.getNumberOfElements());
+	}
+}
+
+template<bool Cardinality>
+void epic::index::MinimalWinningCoalitions<Cardinality>::step() {
+	--mPlayer;
+	removePlayer(mPlayer);
+	updateBackward(mPlayer);
+}
+
+template<bool Cardinality>
+void epic::index::MinimalWinningCoalitions<Cardinality>::addWeight(lint::LargeNumber* f, longUInt size, longUInt w) {
+	for (longUInt end = (w < size) ? size - w : 0; end > 0;) {
+		longUInt begin = (end > w) ? end - w : 0;
+		gCalculator->plusEqual(&f[begin + w], &f[begin], end - begin);
+		end = begin;
+	}
+}
+
+template<bool Cardinality>
+void epic::index::MinimalWinningCoalitions<Cardinality>::addPlayer(longUInt i) {
+	longUInt wi = mGame->getWeights()[i];
+	if (wi >= mQuota) {
+		return;
+	}
+
+	if constexpr (Cardinality) {
+		// the rows only depend on smaller cardinalities, i.e. starting at the top each row can get updated by a single span
+		for (longUInt k = std::min(i + 1, mRows - 1); k > 0 && k < mRows; --k) {
+			gCalculator->plusEqual(&mF(k, wi), &mF(k - 1, 0), mQuota - wi);
+		}
+	} else {
+		addWeight(mF.getArray(0), mQuota, wi);
+	}
+}
+
+template<bool Cardinality>
+void epic::index::MinimalWinningCoalitions<Cardinality>::removePlayer(longUInt i) {
+	longUInt wi = mGame->getWeights()[i];
+	if (wi >= mQuota) {
+		return;
+	}
+
+	if constexpr (Cardinality) {
+		// f(k + 1, x) -= f(k, x - wi), where row k already is the one without player i
+		for (longUInt k = 0; k + 1 < mRows && k <= i; ++k) {
+			gCalculator->minus(&mF(k + 1, wi), &mF(k + 1, wi), &mF(k, 0), mQuota - wi);
+		}
+	} else {
+		// each block of wi consecutive weights only depends on the block below
+		lint::LargeNumber* f = mF.getArray(0);
+		for (longUInt begin = wi; begin < mQuota; begin += wi) {
+			gCalculator->minus(&f[begin], &f[begin], &f[begin - wi], std::min(wi, mQuota - begin));
+		}
+	}
+}
+
+template<bool Cardinality>
+void epic::index::MinimalWinningCoalitions<Cardinality>::initBackward() {
+	if (!mBackward) {
+		return;
+	}
+
+	longUInt w_last = mGame->getWeights()[mGame->getNumberOfNonZeroPlayers() - 1];
+	assignSingleton(1, std::min(w_last, mQuota) + 1);
+}
+
+template<bool Cardinality>
+void epic::index::MinimalWinningCoalitions<Cardinality>::updateBackward(longUInt i) {
+	if (!mBackward) {
+		return;
+	}
+
+	longUInt wi = mGame->getWeights()[i];
+	longUInt wi_plus1 = mGame->getWeights()[i + 1];
+	longUInt d = wi - wi_plus1;
+
+	// b(m, r) = b(m, r - d) + b(m - 1, r - wi) for r in (wi, quota], using the values of player i + 1 only
+	if (wi < mQuota) {
+		longUInt len = mQuota - wi;
+
+		if constexpr (Cardinality) {
+			// b(m, .) only depends on rows <= m, i.e. starting at the top each row can get updated in place. Row m can only be non-zero if the players i, ..., n - 1 contain at least m + 1 players.
+			longUInt rows = std::min(mRows, mGame->getNumberOfNonZeroPlayers() - i);
+			for (longUInt m = rows - 1; m < rows; --m) {
+				lint::LargeNumber* row = mB.getArray(m);
+
+				if (d > 0) {
+					if (d >= len) {
+						gCalculator->assign(&row[wi + 1], &row[wi_plus1 + 1], len);
+					} else {
+						gCalculator->assign(mHelper.getArrayPointer(), &row[wi_plus1 + 1], len);
+						gCalculator->assign(&row[wi + 1], mHelper.getArrayPointer(), len);
+					}
+				}
+
+				if (m > 0) {
+					gCalculator->plusEqual(&row[wi + 1], &mB(m - 1, 1), len);
+				}
+			}
+		} else {
+			lint::LargeNumber* row = mB.getArray(0);
+
+			if (d > 0) {
+				// both sources lie in [1, quota - d] and get read before being overwritten
+				lint::LargeNumber* old_row = mHelper.getArrayPointer();
+				gCalculator->assign(old_row, &row[1], mQuota - d);
+				gCalculator->assign(&row[wi + 1], &old_row[wi_plus1], len);
+				gCalculator->plusEqual(&row[wi + 1], &old_row[0], len);
+			} else {
+				// b(r) += b(r - wi): blocks of wi consecutive weights starting at the top
+				for (longUInt end = mQuota + 1; end > wi + 1;) {
+					longUInt begin = std::max(end - wi, wi + 1);
+					gCalculator->plusEqual(&row[begin], &row[begin - wi], end - begin);
+					end = begin;
+				}
+			}
+		}
+	}
+
+	// for r in (w_{i+1}, wi] player i alone covers the deficit
+	assignSingleton(wi_plus1 + 1, std::min(wi, mQuota) + 1);
+}
+
+template<bool Cardinality>
+void epic::index::MinimalWinningCoalitions<Cardinality>::assignSingleton(longUInt begin, longUInt end) {
+	if (begin >= end) {
+		return;
+	}
+
+	for (longUInt r = begin; r < end; ++r) {
+		gCalculator->assign_one(mB(0, r));
+	}
+	for (longUInt m = 1; m < mRows; ++m) {
+		gCalculator->assign_zero(&mB(m, begin), end - begin);
+	}
+}
+
+template class epic::index::MinimalWinningCoalitions<false>;
+template class epic::index::MinimalWinningCoalitions<true>;
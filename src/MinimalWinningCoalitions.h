@@ -0,0 +1,256 @@
+#ifndef EPIC_INDEX_MINIMALWINNINGCOALITIONS_H_
+#define EPIC_INDEX_MINIMALWINNINGCOALITIONS_H_
+
+#include "Array.h"
+#include "Game.h"
+#include "LargeNumber.h"
+#include "Parallel.h"
+#include "types.h"
+
+#include <vector>
+
+namespace epic::index {
+
+/**
+ * The dynamic programs counting minimal winning coalitions, shared by the indices based on them (PublicGood, AbsolutePublicGood, RawFelsenthal, FelsenthalIndex, SingleValueWS, RawDeeganPackel, DeeganPackel and SingleValueWM).
+ *
+ * A coalition S is a minimal winning coalition containing player i if S is winning and removing its lightest player makes it losing. Splitting S into the part S' of the players heavier than i (players 0, ..., i - 1) and the part T of the players i, ..., n - 1 (containing i), the number of those coalitions is
+ *
+ * sum_{x < q} f(x) * b(q - x)
+ *
+ * with
+ * - the forward table f(x): the number of coalitions S' of the players 0, ..., i - 1 having weight x
+ * - the backward table b(r): the number of coalitions T of the players i, ..., n - 1 containing i whose weight is at least r but which lose the deficit r if their lightest player gets removed
+ *
+ * The players get processed from the lightest to the heaviest one: f starts containing the players 0, ..., n - 2 and each player gets removed from it (the inverse of adding a player), while b gets derived from the one of the next lighter player:
+ *
+ * b_i(r) = 1 for r <= w_i and b_i(r) = b_{i+1}(r - w_i + w_{i+1}) + b_{i+1}(r - w_i) otherwise
+ *
+ * Both updates work on whole spans of LargeNumbers (see ItfLargeNumberCalculator::plusEqual() and ItfLargeNumberCalculator::minus()), i.e. each backend runs its own optimized loops.
+ *
+ * @tparam Cardinality If true, both tables additionally track the number of players: f(k, x) counts the coalitions S' of k players, b(m, r) the coalitions T of m players. Only the coalitions of at most max_cardinality players get tracked (e.g. the minimal winning coalitions of least size for the <i>Felsenthal</i> index). If false, the cardinalities get summed up.
+ *
+ * @note Players of weight zero are never part of a minimal winning coalition and get ignored. The tables get allocated using gCalculator, i.e. the object must get deleted before gCalculator gets removed.
+ */
+template<bool Cardinality> class MinimalWinningCoalitions {
+public:
+	/**
+	 * Allocating the tables and calculating f for the players 0, ..., n - 2
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param max_cardinality The largest number of players of a tracked coalition (only used if Cardinality is true)
+	 * @param backward If false, only f gets calculated (e.g. if the caller keeps its own backward table)
+	 */
+	MinimalWinningCoalitions(Game* g, longUInt max_cardinality = 0, bool backward = true);
+
+	/**
+	 * Copying the current state of the tables (e.g. to continue the sweep of forEachPlayer() on another thread)
+	 */
+	MinimalWinningCoalitions(const MinimalWinningCoalitions& other);
+	~MinimalWinningCoalitions();
+
+	MinimalWinningCoalitions& operator=(const MinimalWinningCoalitions&) = delete;
+
+	/**
+	 * Executing func(tables, i) for each non-zero player i
+	 *
+	 * During the call of func(tables, i), f of tables contains the players 0, ..., i - 1 and b of tables belongs to player i. The combinations (see addMinimalWinningCoalitions()) are only valid inside func.
+	 *
+	 * Deriving f and b of player i needs the ones of player i + 1. Therefore the players get split into consecutive blocks, one per thread (see Parallel::getNumberOfThreads()): A single pass without any combinations (only removing the players from f and updating b) stores a copy of the tables at the lightest player of each block. Afterwards each block sweeps over its players starting at its copy, i.e. the combinations (the expensive part) of all blocks run concurrently.
+	 *
+	 * @tparam Func A callable with the signature void(MinimalWinningCoalitions& tables, longUInt player). If multiple threads get used, it gets called concurrently for different players and different tables.
+	 * @param func The per player function
+	 *
+	 * @note If the object got constructed with backward == false, the players get processed sequentially, starting at the lightest one (e.g. for a backward table of the caller).
+	 */
+	template<class Func> void forEachPlayer(Func&& func) {
+		longUInt n = mGame->getNumberOfNonZeroPlayers();
+		longUInt number_of_blocks = getNumberOfBlocks(mGame, mRows, mBackward);
+
+		initBackward();
+		mPlayer = n - 1;
+
+		if (number_of_blocks <= 1) {
+			func(*this, mPlayer);
+			while (mPlayer > 0) {
+				step();
+				func(*this, mPlayer);
+			}
+			return;
+		}
+
+		// block c contains the players [first[c], first[c + 1]), block 0 the heaviest ones
+		std::vector<longUInt> first(number_of_blocks + 1);
+		for (longUInt c = 0; c <= number_of_blocks; ++c) {
+			first[c] = c * n / number_of_blocks;
+		}
+
+		std::vector<MinimalWinningCoalitions*> tables(number_of_blocks, this);
+		try {
+			for (longUInt c = number_of_blocks - 1; c > 0; --c) {
+				while (mPlayer > first[c + 1] - 1) {
+					step();
+				}
+				tables[c] = new MinimalWinningCoalitions(*this);
+			}
+			while (mPlayer > first[1] - 1) {
+				step();
+			}
+
+			Parallel::for_each(number_of_blocks, number_of_blocks, [&](longUInt, longUInt c) {
+				func(*tables[c], tables[c]->mPlayer);
+				while (tables[c]->mPlayer > first[c]) {
+					tables[c]->step();
+					func(*tables[c], tables[c]->mPlayer);
+				}
+			});
+		} catch (...) {
+			for (longUInt c = 1; c < number_of_blocks; ++c) {
+				if (tables[c] != this) {
+					delete tables[c];
+				}
+			}
+			throw;
+		}
+
+		for (longUInt c = 1; c < number_of_blocks; ++c) {
+			delete tables[c];
+		}
+	}
+
+	/**
+	 * Getting a row of the forward table
+	 *
+	 * @param cardinality The number of players of the coalitions (must be 0 if Cardinality is false)
+	 * @return The array f(cardinality, x) for x in [0, quota)
+	 */
+	lint::LargeNumber* getCoalitionsPerWeight(longUInt cardinality = 0);
+
+	/**
+	 * dest += the number of minimal winning coalitions containing the current player (see forEachPlayer()). Only available if Cardinality is false.
+	 *
+	 * @param dest The LargeNumber the result gets added to
+	 */
+	void addMinimalWinningCoalitions(lint::LargeNumber& dest);
+
+	/**
+	 * dest += the number of minimal winning coalitions of the given cardinality containing the current player (see forEachPlayer()). Only available if Cardinality is true.
+	 *
+	 * @param dest The LargeNumber the result gets added to
+	 * @param cardinality The number of players of the coalitions (at most max_cardinality)
+	 */
+	void addMinimalWinningCoalitions(lint::LargeNumber& dest, longUInt cardinality);
+
+	/**
+	 * Getting the memory the tables need (including the copies of forEachPlayer())
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param max_cardinality see MinimalWinningCoalitions()
+	 * @param backward see MinimalWinningCoalitions()
+	 * @return The memory requirement in Bytes
+	 */
+	static bigInt getMemoryRequirement(Game* g, longUInt max_cardinality = 0, bool backward = true);
+
+	/**
+	 * Calculating the total number of minimal winning coalitions
+	 *
+	 * Each minimal winning coalition gets counted once for its lightest player i, i.e. as coalition S' of the players 0, ..., i - 1 whose weight is in [q - w_i, q). This needs a single forward pass and no backward table.
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param total_mwc The total number of minimal winning coalitions
+	 */
+	static void totalNumberOfMinimalWinningCoalitions(Game* g, bigInt* total_mwc);
+
+private:
+	/**
+	 * The minimum number of players per block of forEachPlayer()
+	 */
+	static constexpr longUInt cMinPlayersPerBlock = 16;
+
+	Game* mGame;
+	longUInt mQuota;
+
+	/**
+	 * The number of rows of f (the cardinalities 0, ..., mRows - 1) and b (the cardinalities 1, ..., mRows)
+	 */
+	longUInt mRows;
+	bool mBackward;
+
+	/**
+	 * The player of the current forEachPlayer() call
+	 */
+	longUInt mPlayer;
+
+	/**
+	 * mF(k, x): f(k, x) for x in [0, quota)
+	 * mB(m, r): b(m + 1, r) for r in [0, quota]
+	 */
+	Array2d<lint::LargeNumber> mF, mB;
+
+	/**
+	 * A copy of (a part of) a row of mB (quota elements)
+	 */
+	ArrayOffset<lint::LargeNumber> mHelper;
+
+	/**
+	 * Getting the memory of a single set of tables in Bytes
+	 */
+	static bigInt getTableSize(Game* g, longUInt rows, bool backward);
+
+	/**
+	 * Getting the number of blocks (and threads) forEachPlayer() uses
+	 */
+	static longUInt getNumberOfBlocks(Game* g, longUInt rows, bool backward);
+
+	/**
+	 * Allocating (and zero initializing) the tables
+	 */
+	void allocTables();
+
+	/**
+	 * Moving on to the next heavier player, i.e. removing it from f and deriving its b
+	 */
+	void step();
+
+	/**
+	 * Adding a player of weight w to the coalitions per weight f[x] (x in [0, size))
+	 *
+	 * Blocks of w consecutive weights do not overlap their targets and get added as single spans starting at the top.
+	 */
+	static void addWeight(lint::LargeNumber* f, longUInt size, longUInt w);
+
+	/**
+	 * Adding the player i to f (f contains the players 0, ..., i - 1 before)
+	 */
+	void addPlayer(longUInt i);
+
+	/**
+	 * Removing the player i from f (f contains the players 0, ..., i before)
+	 */
+	void removePlayer(longUInt i);
+
+	/**
+	 * Initializing b for the last non-zero player
+	 */
+	void initBackward();
+
+	/**
+	 * Deriving b of player i from b of player i + 1
+	 */
+	void updateBackward(longUInt i);
+
+	/**
+	 * Setting b(m, r) for r in [begin, end) to the values of a coalition T = {i}, i.e. 1 if m == 1 and 0 otherwise
+	 */
+	void assignSingleton(longUInt begin, longUInt end);
+};
+
+template<> void MinimalWinningCoalitions<false>::addMinimalWinningCoalitions(lint::LargeNumber& dest);
+template<> void MinimalWinningCoalitions<true>::addMinimalWinningCoalitions(lint::LargeNumber& dest, longUInt cardinality);
+
+extern template class MinimalWinningCoalitions<false>;
+extern template class MinimalWinningCoalitions<true>;
+
+} /* namespace epic::index */
+
+#endif /* EPIC_INDEX_MINIMALWINNINGCOALITIONS_H_ */
@@ -15,7 +15,7 @@ std::vector<epic::bigFloat> epic::index::NevisonPH::calculate(Game* g) {
 
 	std::vector<bigFloat> solution(g->getNumberOfPlayers());
 	{
-		bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0(); // additional winning coalitions due to players of weight 0
+		bigInt factor = coalitionsOfPlayersWithWeight0(g); // additional winning coalitions due to players of weight 0
 		bigInt tmp = bigInt(1) << g->getNumberOfPlayers() - 1;
 		bigFloat combinations = tmp;
 
@@ -2,13 +2,13 @@
 
 #include "Array.h"
 #include "GlobalCalculator.h"
+#include "Parallel.h"
 
 epic::index::Owen::Owen()
 	: PowerIndexWithPrecoalitions() {}
 
 std::vector<epic::bigFloat> epic::index::Owen::calculate(Game* g_) {
 	auto g = static_cast<PrecoalitionGame*>(g_);
-	gCalculator->alloc_largeNumber(mTmp);
 	std::vector<bigFloat> solution;
 
 	if (g->getNumberOfVetoPlayers() > 0) {
@@ -30,76 +30,143 @@ std::vector<epic::bigFloat> epic::index::Owen::calculate(Game* g_) {
 			}
 		}
 
-		Array2dOffset<lint::LargeNumber> cc(g->getWeightSum() + 1, g->getNumberOfPrecoalitions(), g->getQuota(), 0);
-		gCalculator->allocInit_largeNumberArray(cc.getArrayPointer(), cc.getNumberOfElements());
-		gCalculator->assign_one(cc(g->getWeightSum(), g->getNumberOfPrecoalitions() - 1));
-		generalizedBackwardCountingPerWeightCardinality(g, cc, g->getPrecoalitionWeights(), g->getNumberOfPrecoalitions());
+		/*
+		 * Precoalitions and players of weight 0 never change whether a coalition is winning. They get excluded from all tables, their effect on the cardinalities gets folded into the factorial weights instead (see cardinalityWeightsWithPlayersOfWeight0()). Their own values stay zero.
+		 */
+		std::vector<longUInt> external;		  // the precoalitions of non-zero weight
+		std::vector<longUInt> external_weights; // their weights
+		for (longUInt i = 0; i < g->getNumberOfPrecoalitions(); ++i) {
+			if (g->getPrecoalitionWeights()[i] > 0) {
+				external.push_back(i);
+				external_weights.push_back(g->getPrecoalitionWeights()[i]);
+			}
+		}
+		longUInt n_external = external.size();
+
+		// external_factor[s] = sum_j C(z, j) * (s + j)! * (nbPartitions - s - j - 1)! for z precoalitions of weight 0
+		std::vector<bigInt> external_factor;
+		{
+			std::vector<bigInt> h(g->getNumberOfPrecoalitions());
+			for (longUInt s = 0; s < g->getNumberOfPrecoalitions(); ++s) {
+				h[s] = factorial[s] * factorial[g->getNumberOfPrecoalitions() - s - 1];
+			}
+			external_factor = cardinalityWeightsWithPlayersOfWeight0(h, g->getNumberOfPrecoalitions() - n_external);
+		}
 
-		Array2dOffset<lint::LargeNumber> cw(g->getWeightSum() + 1, g->getNumberOfPrecoalitions(), g->getQuota(), 0);
-		gCalculator->allocInit_largeNumberArray(cw.getArrayPointer(), cw.getNumberOfElements());
+		Array2dOffset<lint::LargeNumber> cc(g->getWeightSum() + 1, n_external, g->getQuota(), 0);
+		gCalculator->allocInit_largeNumberArray(cc.getArrayPointer(), cc.getNumberOfElements());
+		gCalculator->assign_one(cc(g->getWeightSum(), n_external - 1));
+		generalizedBackwardCountingPerWeightCardinality(g, cc, external_weights, n_external);
 
 		auto shapleysInternal = new bigInt[g->getNumberOfPlayers()]();
 
-		Array2dOffset<lint::LargeNumber> cw2(g->getWeightSum() + 1, g->getMaxPrecoalitionSize(), g->getQuota(), 0);
-		gCalculator->allocInit_largeNumberArray(cw2.getArrayPointer(), cw2.getNumberOfElements());
+		/*
+		 * The precoalitions are independent of each other: They only read cc and write shapleysInternal of their own members. Therefore the precoalitions get distributed onto multiple threads (the largest ones first), each thread using its own tables cw, cw2 and cwi.
+		 */
+		longUInt table_size = (g->getWeightSum() + 1 - g->getQuota()) * (n_external + 2 * g->getMaxPrecoalitionSize());
+		longUInt number_of_threads = Parallel::getNumberOfThreads(n_external, table_size * gCalculator->getLargeNumberSize());
 
-		Array2dOffset<lint::LargeNumber> cwi(g->getWeightSum() + 1, g->getMaxPrecoalitionSize(), g->getQuota(), 0);
-		gCalculator->alloc_largeNumberArray(cwi.getArrayPointer(), cwi.getNumberOfElements());
+		std::vector<Array2dOffset<lint::LargeNumber>> cws(number_of_threads), cw2s(number_of_threads), cwis(number_of_threads);
+		for (longUInt t = 0; t < number_of_threads; ++t) {
+			cws[t].alloc(g->getWeightSum() + 1, n_external, g->getQuota(), 0);
+			gCalculator->allocInit_largeNumberArray(cws[t].getArrayPointer(), cws[t].getNumberOfElements());
 
-		std::vector<longUInt> winternal(g->getMaxPrecoalitionSize());
+			cw2s[t].alloc(g->getWeightSum() + 1, g->getMaxPrecoalitionSize(), g->getQuota(), 0);
+			gCalculator->allocInit_largeNumberArray(cw2s[t].getArrayPointer(), cw2s[t].getNumberOfElements());
 
-		bigInt factor;
+			cwis[t].alloc(g->getWeightSum() + 1, g->getMaxPrecoalitionSize(), g->getQuota(), 0);
+			gCalculator->alloc_largeNumberArray(cwis[t].getArrayPointer(), cwis[t].getNumberOfElements());
+		}
+
+		// order[task]: index in external, the largest precoalitions first
+		std::vector<longUInt> order;
+		{
+			std::vector<longUInt> external_index(g->getNumberOfPrecoalitions());
+			for (longUInt e = 0; e < n_external; ++e) {
+				external_index[external[e]] = e;
+			}
+			for (longUInt i : precoalitionsBySize(g)) {
+				if (g->getPrecoalitionWeights()[i] > 0) {
+					order.push_back(external_index[i]);
+				}
+			}
+		}
+
+		Parallel::for_each(n_external, number_of_threads, [&](longUInt thread_id, longUInt task) {
+			longUInt e = order[task];
+			longUInt i = external[e];
+			Array2dOffset<lint::LargeNumber>& cw = cws[thread_id];
+			Array2dOffset<lint::LargeNumber>& cw2 = cw2s[thread_id];
+			Array2dOffset<lint::LargeNumber>& cwi = cwis[thread_id];
+
+			lint::LargeNumber tmp;
+			gCalculator->alloc_largeNumber(tmp);
+			bigInt big_tmp;
+			bigInt factor;
 
-		for (longUInt i = 0; i < g->getNumberOfPrecoalitions(); ++i) {
 			longUInt nbPlayersInPartI = g->getPrecoalitions()[i].size();
 
-			coalitionsCardinalityContainingPlayerFromAbove(g, cw, cc, g->getNumberOfPrecoalitions(), i, g->getPrecoalitionWeights());
+			coalitionsCardinalityContainingPlayerFromAbove(g, cw, cc, n_external, e, external_weights);
 
-			// initialize winternal
+			// initialize winternal and members with the players of non-zero weight
+			std::vector<longUInt> winternal;
+			std::vector<longUInt> members;
 			for (longUInt z = 0; z < nbPlayersInPartI; ++z) {
-				winternal[z] = g->getWeights()[g->getPrecoalitions()[i][z]];
+				longUInt player = g->getPrecoalitions()[i][z];
+				if (g->getWeights()[player] > 0) {
+					winternal.push_back(g->getWeights()[player]);
+					members.push_back(player);
+				}
+			}
+			longUInt nbMembers = members.size();
+
+			// internal_factor[sinternal] = sum_j C(z, j) * (sinternal + j)! * (nbPlayersInPartI - sinternal - j - 1)! for z members of weight 0
+			std::vector<bigInt> internal_factor;
+			{
+				std::vector<bigInt> h(nbPlayersInPartI);
+				for (longUInt sinternal = 0; sinternal < nbPlayersInPartI; ++sinternal) {
+					h[sinternal] = factorial[sinternal] * factorial[nbPlayersInPartI - sinternal - 1];
+				}
+				internal_factor = cardinalityWeightsWithPlayersOfWeight0(h, nbPlayersInPartI - nbMembers);
 			}
 
-			for (longUInt s = 0; s < g->getNumberOfPrecoalitions(); ++s) {
-				factor = factorial[s] * factorial[g->getNumberOfPrecoalitions() - s - 1];
+			for (longUInt s = 0; s < n_external; ++s) {
+				factor = external_factor[s];
 
-				if (nbPlayersInPartI > 1) {
+				if (nbMembers > 1) {
 					for (longUInt x = g->getQuota(); x <= g->getWeightSum(); ++x) {
-						for (longUInt y = 0; y < nbPlayersInPartI - 1; ++y) {
-							gCalculator->assign_zero(cw2(x, y));
-						}
-						gCalculator->assign(cw2(x, nbPlayersInPartI - 1), cw(x, s));
+						gCalculator->assign_zero(&cw2(x, 0), nbMembers - 1);
+						gCalculator->assign(cw2(x, nbMembers - 1), cw(x, s));
 					}
 
-					generalizedBackwardCountingPerWeightCardinality(g, cw2, winternal, nbPlayersInPartI);
+					generalizedBackwardCountingPerWeightCardinality(g, cw2, winternal, nbMembers);
 
-					for (longUInt x = g->getQuota(); x <= g->getWeightSum(); ++x) {
-						for (longUInt y = 0; y < nbPlayersInPartI; ++y) {
-							gCalculator->assign(cwi(x, y), cw2(x, y));
-						}
-					}
-
-					for (longUInt ii = 0; ii < nbPlayersInPartI; ++ii) {
-						coalitionsCardinalityContainingPlayerFromAbove(g, cwi, cw2, nbPlayersInPartI, ii, winternal);
-						updateInternalShapleyShubik(g, shapleysInternal, cwi, i, ii, winternal, factorial, factor);
+					// coalitionsCardinalityContainingPlayerFromAbove() initializes cwi with cw2 itself
+					for (longUInt ii = 0; ii < nbMembers; ++ii) {
+						coalitionsCardinalityContainingPlayerFromAbove(g, cwi, cw2, nbMembers, ii, winternal);
+						updateInternalShapleyShubik(g, shapleysInternal[members[ii]], cwi, nbMembers, winternal[ii], internal_factor, factor, tmp, big_tmp);
 					}
 				} else {
-					// shapleysInternal[g->getPrecoalitions()[i][0] - 1] += factor * sum(cw[q:tmp_min, s])
-					gCalculator->assign_zero(mTmp);
-					longUInt tmp_min = std::min(g->getQuota() + g->getPrecoalitionWeights()[i] - 1, g->getWeightSum());
-					for (longUInt z = g->getQuota(); z <= tmp_min; ++z) {
-						gCalculator->plusEqual(mTmp, cw(z, s));
-					}
-					gCalculator->to_bigInt(&mBigTmp, mTmp);
-					shapleysInternal[g->getPrecoalitions()[i][0]] += mBigTmp * factor;
+					// shapleysInternal[members[0]] += factor * internal_factor[0] * sum(cw[q:tmp_min, s])
+					gCalculator->assign_zero(tmp);
+					longUInt tmp_min = std::min(g->getQuota() + external_weights[e] - 1, g->getWeightSum());
+					gCalculator->plusEqualSum(tmp, &cw(g->getQuota(), s), tmp_min + 1 - g->getQuota(), n_external); // column s of cw
+					gCalculator->to_bigInt(&big_tmp, tmp);
+					shapleysInternal[members[0]] += big_tmp * factor * internal_factor[0];
 				}
 			}
-		}
+
+			gCalculator->free_largeNumber(tmp);
+		});
 
 		gCalculator->free_largeNumberArray(cc.getArrayPointer());
-		gCalculator->free_largeNumberArray(cw.getArrayPointer());
-		gCalculator->free_largeNumberArray(cw2.getArrayPointer());
-		gCalculator->free_largeNumberArray(cwi.getArrayPointer());
+		for (longUInt t = 0; t < number_of_threads; ++t) {
+			gCalculator->free_largeNumberArray(cws[t].getArrayPointer());
+			gCalculator->free_largeNumberArray(cw2s[t].getArrayPointer());
+			gCalculator->free_largeNumberArray(cwis[t].getArrayPointer());
+		}
+
+		bigInt factor;
 
 		solution.resize(g->getNumberOfPlayers());
 		{
@@ -120,8 +187,6 @@ std::vector<epic::bigFloat> epic::index::Owen::calculate(Game* g_) {
 		delete[] shapleysInternal;
 	}
 
-	gCalculator->free_largeNumber(mTmp);
-
 	return solution;
 }
 
@@ -132,13 +197,15 @@ std::string epic::index::Owen::getFullName() {
 epic::longUInt epic::index::Owen::getMemoryRequirement(Game* g_) {
 	auto g = static_cast<PrecoalitionGame*>(g_);
 
+	bigInt table_size = bigInt(g->getWeightSum() + 1 - g->getQuota()) * (g->getNumberOfPrecoalitions() + 2 * g->getMaxPrecoalitionSize()) * gCalculator->getLargeNumberSize();
+	longUInt number_of_threads = table_size.fits_ulong_p() ? Parallel::getNumberOfThreads(g->getNumberOfPrecoalitions(), table_size.get_ui()) : 1;
+
 	bigInt memory = g->getNumberOfPrecoalitions() * c_sizeof_longUInt; // g->getPrecoalitionWeights()
 	longUInt max = std::max(g->getMaxPrecoalitionSize(), g->getNumberOfPrecoalitions());
-	memory += max * GMPHelper::size_of_float(bigInt::factorial(max));														   // factorial
-	memory += (g->getWeightSum() + 1 - g->getQuota()) * g->getNumberOfPrecoalitions() * gCalculator->getLargeNumberSize() * 2; // cc, cw
-	memory += g->getNumberOfPlayers() * GMPHelper::size_of_int(bigInt::factorial(g->getMaxPrecoalitionSize()));				   // shapleyInternal (only very rough approximation
-	memory += (g->getWeightSum() + 1 - g->getQuota()) * g->getMaxPrecoalitionSize() * gCalculator->getLargeNumberSize() * 2;   // cw2, cwi
-	memory += g->getMaxPrecoalitionSize() * c_sizeof_longUInt;																   // winternal
+	memory += max * GMPHelper::size_of_float(bigInt::factorial(max));												  // factorial
+	memory += (g->getWeightSum() + 1 - g->getQuota()) * g->getNumberOfPrecoalitions() * gCalculator->getLargeNumberSize(); // cc
+	memory += g->getNumberOfPlayers() * GMPHelper::size_of_int(bigInt::factorial(g->getMaxPrecoalitionSize()));		  // shapleyInternal (only very rough approximation
+	memory += (table_size + g->getMaxPrecoalitionSize() * c_sizeof_longUInt) * number_of_threads;					  // cw, cw2, cwi, winternal (one per thread)
 
 	memory /= cMemUnit_factor;
 	longUInt ret = 0;
@@ -157,17 +224,16 @@ epic::lint::Operation epic::index::Owen::getOperationRequirement() {
 	return lint::Operation::addition;
 }
 
-void epic::index::Owen::updateInternalShapleyShubik(PrecoalitionGame* g, bigInt* internal_ssi, Array2dOffset<lint::LargeNumber>& cwi, longUInt precoalition, longUInt player, std::vector<longUInt>& weights, bigInt* factorial, bigInt& scale_factor) {
-	longUInt n = g->getPrecoalitions()[precoalition].size();
-
+void epic::index::Owen::updateInternalShapleyShubik(PrecoalitionGame* g, bigInt& internal_ssi, Array2dOffset<lint::LargeNumber>& cwi, longUInt n, longUInt weight, const std::vector<bigInt>& internal_factor, bigInt& scale_factor, lint::LargeNumber& tmp, bigInt& big_tmp) {
+	// the scale factor is the same for all cardinalities, i.e. it only gets multiplied once
+	bigInt sum = 0;
 	for (longUInt sinternal = 0; sinternal < n; ++sinternal) {
-		gCalculator->assign_zero(mTmp);
-		longUInt min = std::min(g->getQuota() + weights[player] - 1, g->getWeightSum());
-		for (longUInt w = g->getQuota(); w <= min; ++w) {
-			gCalculator->plusEqual(mTmp, cwi(w, sinternal));
-		}
+		gCalculator->assign_zero(tmp);
+		longUInt min = std::min(g->getQuota() + weight - 1, g->getWeightSum());
+		gCalculator->plusEqualSum(tmp, &cwi(g->getQuota(), sinternal), min + 1 - g->getQuota(), g->getMaxPrecoalitionSize()); // column sinternal of cwi
 
-		gCalculator->to_bigInt(&mBigTmp, mTmp);
-		internal_ssi[g->getPrecoalitions()[precoalition][player]] += (factorial[sinternal] * factorial[n - sinternal - 1]) * mBigTmp * scale_factor;
+		gCalculator->to_bigInt(&big_tmp, tmp);
+		sum += internal_factor[sinternal] * big_tmp;
 	}
+	internal_ssi += sum * scale_factor;
 }
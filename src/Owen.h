@@ -19,16 +19,9 @@ public:
 
 private:
 	/**
-	 * temporary variable - avoids temporary allocations inside the loops.
+	 * internal_ssi += scale_factor * sum_{sinternal < n} internal_factor[sinternal] * (number of coalitions of internal cardinality sinternal the player of the given weight is a swing player in)
 	 */
-	lint::LargeNumber mTmp;
-
-	/**
-	 * temporary variable - avoids temporary allocations inside the loops.
-	 */
-	bigInt mBigTmp;
-
-	void updateInternalShapleyShubik(PrecoalitionGame* g, bigInt* internal_ssi, Array2dOffset<lint::LargeNumber>& cwi, longUInt precoalition, longUInt player, std::vector<longUInt>& weights, bigInt* factorial, bigInt& scale_factor);
+	void updateInternalShapleyShubik(PrecoalitionGame* g, bigInt& internal_ssi, Array2dOffset<lint::LargeNumber>& cwi, longUInt n, longUInt weight, const std::vector<bigInt>& internal_factor, bigInt& scale_factor, lint::LargeNumber& tmp, bigInt& big_tmp);
 };
 
 } /* namespace epic::index */
@@ -2,6 +2,7 @@
 
 #include "Logging.h"
 #include "PublicGood.h"
+#include "PublicGoodSolver.h"
 #include "GlobalCalculator.h"
 
 #include <cmath>
@@ -16,6 +17,7 @@ std::vector<epic::bigFloat> epic::index::OwenExtendedPGI::calculate(Game* g_) {
 	// Create game object from weights of precoalitions with original quota
 	auto precoalitionGame = new Game(g->getQuota(), g->getPrecoalitionWeights(), false);
 	PublicGood* pgi = new PublicGood();
+	PublicGoodSolver intPgi; // solving the internal games
 
 	//players in precoalitionGame are already in descending order
 	if (precoalitionGame->getWeights()[0] >= g->getQuota()) {
@@ -24,33 +26,23 @@ std::vector<epic::bigFloat> epic::index::OwenExtendedPGI::calculate(Game* g_) {
 		// Find out number of dictator precoalitions
 		longUInt nbDictatorCoalitions;
 		nbDictatorCoalitions = 0;
-		while (precoalitionGame->getWeights()[nbDictatorCoalitions] >= g->getQuota()) {
+		while (nbDictatorCoalitions < precoalitionGame->getNumberOfPlayers() && precoalitionGame->getWeights()[nbDictatorCoalitions] >= g->getQuota()) {
 			nbDictatorCoalitions++;
 		}
 		for (longUInt jd =0; jd < nbDictatorCoalitions; jd++){
 			longUInt kk = precoalitionGame->getPermutation().inverseIndex(jd);
 			longUInt nbPlayersInParti = g->getPrecoalitions()[kk].size();
 
-			Game* intGame = nullptr;
-			{
-				std::vector<longUInt> weightsVector(nbPlayersInParti);
-				for (longUInt ii = 0; ii < nbPlayersInParti; ii++) {
-					weightsVector[ii] = g->getWeights()[g->getPrecoalitions()[kk][ii]];
-				}
-				intGame = new Game(g->getQuota(), weightsVector, false);
+			std::vector<longUInt> weightsVector(nbPlayersInParti);
+			for (longUInt ii = 0; ii < nbPlayersInParti; ii++) {
+				weightsVector[ii] = g->getWeights()[g->getPrecoalitions()[kk][ii]];
 			}
 
-			std::vector<bigFloat> sortedSolution(nbPlayersInParti);
-			{
-				std::vector<bigFloat> intSolution(nbPlayersInParti);
-				pgi->calculate(intGame, intSolution);
-
-				intGame->getPermutation().reverse(intSolution, sortedSolution);
-			}
-			delete intGame;
+			std::vector<bigFloat> intSolution(nbPlayersInParti);
+			intPgi.calculate(weightsVector, g->getQuota(), intSolution);
 
 			for (longUInt ii = 0; ii < nbPlayersInParti; ii++) {
-				solution[g->getPrecoalitions()[kk][ii]] = sortedSolution[ii]/nbDictatorCoalitions;
+				solution[g->getPrecoalitions()[kk][ii]] = intSolution[ii]/nbDictatorCoalitions;
 			}
 		}
 	} else { // There is no dictator precoalition
@@ -82,22 +74,14 @@ std::vector<epic::bigFloat> epic::index::OwenExtendedPGI::calculate(Game* g_) {
 				weightsVector[ii] = g->getWeights()[g->getPrecoalitions()[kk][ii]];
 			}
 
-			// calculate helpPGIs
-			std::vector<bigFloat> helpSolution(nbPlayersInParti);
-			for (longUInt iii = 0; iii < precoalWeight; iii++) {
-				if (nbPlayersInParti > 1) {
-					auto helpGame = new Game(iii + 1, weightsVector, false);
-					pgi->calculate(helpGame, helpSolution);
-					helpGame->getPermutation().reverse(helpSolution, helpPGIs[iii]);
-					delete helpGame;
-				} else {
+			// calculate helpPGIs: helpPGIs[iii] is the solution of the internal game using the quota iii + 1
+			if (nbPlayersInParti > 1) {
+				intPgi.calculate(weightsVector, 1, precoalWeight, helpPGIs);
+			} else {
+				for (longUInt iii = 0; iii < precoalWeight; iii++) {
 					helpPGIs[iii][0] = 1;
-					for (longUInt ii = 1; ii < nbPlayersInParti; ++ii) {
-						helpPGIs[iii][ii] = 0;
-					}
 				}
 			}
-			helpSolution.clear();
 
 			// calculate intPGIs
 			if (i > 0) {
@@ -111,9 +95,7 @@ std::vector<epic::bigFloat> epic::index::OwenExtendedPGI::calculate(Game* g_) {
 
 			if (i < (g->getNumberOfPrecoalitions()) - 1) {
 				// initialize interm2 with interm
-				for (longUInt weight = 0; weight < g->getQuota(); weight++) {
-					gCalculator->assign(interm2[weight], interm[weight]);
-				}
+				gCalculator->assign(interm2, interm, g->getQuota());
 
 				for (longUInt j = i + 1; j < g->getNumberOfPrecoalitions(); j++) {
 					longUInt precoalWeight_j = precoalitionGame->getWeights()[j];
@@ -206,6 +188,7 @@ epic::longUInt epic::index::OwenExtendedPGI::getMemoryRequirement(Game* g_) {
 	memory += (g->getQuota()) * gCalculator->getLargeNumberSize() * 2;										  // interm, interm2
 	memory += g->getMaxPrecoalitionSize() * gCalculator->getLargeNumberSize();
 	memory += g->getMaxPrecoalitionSize() * c_sizeof_longUInt;
+	memory += PublicGoodSolver::getMemoryRequirement(g->getMaxPrecoalitionSize(), g->getQuota(), g->getQuota()); // internal games (all quotas at once)
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
@@ -0,0 +1,32 @@
+#include "Parallel.h"
+
+#include "MemoryTracker.h"
+
+#include <algorithm>
+
+epic::longUInt epic::Parallel::mNumberOfThreads = 1;
+
+void epic::Parallel::setNumberOfThreads(longUInt number_of_threads) {
+	if (number_of_threads == 0) {
+		number_of_threads = std::thread::hardware_concurrency(); // may return 0 if not computable
+	}
+
+	mNumberOfThreads = std::max(number_of_threads, longUInt{1});
+}
+
+epic::longUInt epic::Parallel::getNumberOfThreads() {
+	return mNumberOfThreads;
+}
+
+epic::longUInt epic::Parallel::getNumberOfThreads(longUInt number_of_tasks, longUInt memory_per_thread) {
+	longUInt ret = std::min(mNumberOfThreads, number_of_tasks);
+
+	longUInt limit = MemoryTracker::getLimit();
+	if (limit > 0 && memory_per_thread > 0) {
+		longUInt usage = MemoryTracker::getLimitedUsage();
+		longUInt fitting = (usage < limit) ? (limit - usage) / memory_per_thread : 0;
+		ret = std::min(ret, fitting);
+	}
+
+	return std::max(ret, longUInt{1});
+}
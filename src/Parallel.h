@@ -0,0 +1,105 @@
+#ifndef EPIC_PARALLEL_H_
+#define EPIC_PARALLEL_H_
+
+#include "types.h"
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace epic {
+
+/**
+ * A helper class to distribute independent tasks (e.g. the per player passes of an index) onto multiple threads.
+ *
+ * @note The LargeNumber operations of gCalculator are thread-safe as long as different threads write to different LargeNumber objects. However, temporary LargeNumber objects (e.g. helper tables) must not be shared between threads. Therefore for_each() passes a thread id to the task which can be used to index per thread data.
+ */
+class Parallel {
+public:
+	Parallel() = delete;
+
+	/**
+	 * Setting the maximum number of threads used by for_each().
+	 *
+	 * @param number_of_threads The maximum number of threads. If 0, the number of hardware threads gets used.
+	 */
+	static void setNumberOfThreads(longUInt number_of_threads);
+
+	/**
+	 * @return The maximum number of threads used by for_each() (always >= 1)
+	 */
+	static longUInt getNumberOfThreads();
+
+	/**
+	 * Getting the number of threads to use for a given number of tasks, each thread needing additional memory.
+	 *
+	 * @param number_of_tasks The number of tasks to execute
+	 * @param memory_per_thread The memory (in Bytes) each thread additionally needs (e.g. for its helper tables)
+	 * @return The number of threads (at least 1, at most getNumberOfThreads() and number_of_tasks). If a memory limit is set (see MemoryTracker::setLimit()) the number of threads gets reduced such that the additional memory fits into the remaining memory.
+	 */
+	static longUInt getNumberOfThreads(longUInt number_of_tasks, longUInt memory_per_thread);
+
+	/**
+	 * Executing func(thread_id, task) for each task in [0, number_of_tasks).
+	 *
+	 * The tasks get assigned dynamically in the given order, i.e. whenever a thread has finished a task it picks the next one that has not been started yet. Therefore tasks should get ordered from the most to the least expensive one.
+	 *
+	 * @tparam Func A callable with the signature void(longUInt thread_id, longUInt task)
+	 * @param number_of_tasks The number of tasks
+	 * @param number_of_threads The number of threads to use. The thread_id passed to func is in the range [0, number_of_threads). If number_of_threads <= 1, all tasks get executed by the calling thread.
+	 * @param func The task function
+	 *
+	 * @note If a task throws an exception, the remaining tasks are not started anymore and the first exception gets rethrown in the calling thread.
+	 */
+	template<class Func> static void for_each(longUInt number_of_tasks, longUInt number_of_threads, Func&& func) {
+		if (number_of_threads <= 1 || number_of_tasks <= 1) {
+			for (longUInt task = 0; task < number_of_tasks; ++task) {
+				func(0, task);
+			}
+			return;
+		}
+
+		std::atomic<longUInt> next_task(0);
+		std::atomic<bool> failed(false);
+		std::exception_ptr exception = nullptr;
+		std::mutex exception_mutex;
+
+		auto worker = [&](longUInt thread_id) {
+			try {
+				for (longUInt task = next_task++; task < number_of_tasks && !failed; task = next_task++) {
+					func(thread_id, task);
+				}
+			} catch (...) {
+				std::lock_guard<std::mutex> lock(exception_mutex);
+				if (!failed) {
+					exception = std::current_exception();
+					failed = true;
+				}
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(number_of_threads - 1);
+		for (longUInt t = 1; t < number_of_threads; ++t) {
+			threads.emplace_back(worker, t);
+		}
+		worker(0);
+
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		if (exception != nullptr) {
+			std::rethrow_exception(exception);
+		}
+	}
+
+private:
+	static longUInt mNumberOfThreads;
+};
+
+} /* namespace epic */
+
+#endif /* EPIC_PARALLEL_H_ */
@@ -2,37 +2,54 @@
 
 #include "GlobalCalculator.h"
 
+#include <algorithm>
+#include <numeric>
+
 epic::index::PowerIndexWithPrecoalitions::PowerIndexWithPrecoalitions()
 	: ItfPowerIndex() {}
 
 void epic::index::PowerIndexWithPrecoalitions::coalitionsContainingPlayerFromAbove(PrecoalitionGame* g, ArrayOffset<lint::LargeNumber>& cw, ArrayOffset<lint::LargeNumber>& cc, longUInt wi) {
-	for (longUInt i = g->getQuota(); i <= g->getWeightSum(); ++i) {
-		gCalculator->assign(cw[i], cc[i]);
+	if (wi == 0) {
+		// cw[i] = cc[i] - cw[i] with cw[i] = cc[i]
+		gCalculator->assign_zero(&cw[g->getQuota()], g->getWeightSum() + 1 - g->getQuota());
+		return;
 	}
 
-	for (longUInt i = g->getWeightSum() - wi; i >= g->getQuota(); --i) {
-		gCalculator->minus(cw[i], cc[i], cw[i + wi]);
+	gCalculator->assign(&cw[g->getQuota()], &cc[g->getQuota()], g->getWeightSum() + 1 - g->getQuota());
+
+	// each block of wi consecutive weights only depends on the block above
+	for (longUInt end = g->getWeightSum() + 1 - wi; end > g->getQuota();) {
+		longUInt begin = (end - g->getQuota() > wi) ? end - wi : g->getQuota();
+		gCalculator->minus(&cw[begin], &cc[begin], &cw[begin + wi], end - begin);
+		end = begin;
 	}
 }
 
 void epic::index::PowerIndexWithPrecoalitions::generalizedBackwardCountingPerWeight(PrecoalitionGame* g, ArrayOffset<lint::LargeNumber>& c, const std::vector<longUInt>& weights, longUInt n) {
 	for (longUInt i = 0; i < n; ++i) {
-		for (longUInt x = g->getQuota() + weights[i]; x <= g->getWeightSum(); ++x) {
-			gCalculator->plusEqual(c[x - weights[i]], c[x]);
+		if (weights[i] == 0) {
+			for (longUInt x = g->getQuota(); x <= g->getWeightSum(); ++x) {
+				gCalculator->plusEqual(c[x], c[x]);
+			}
+		} else if (g->getQuota() + weights[i] <= g->getWeightSum()) {
+			gCalculator->plusEqual(&c[g->getQuota()], &c[g->getQuota() + weights[i]], g->getWeightSum() + 1 - g->getQuota() - weights[i]);
 		}
 	}
 }
 
 void epic::index::PowerIndexWithPrecoalitions::coalitionsCardinalityContainingPlayerFromAbove(PrecoalitionGame* g, Array2dOffset<lint::LargeNumber>& cw, Array2dOffset<lint::LargeNumber>& cc, longUInt n, longUInt p, const std::vector<longUInt>& weights) {
 	for (longUInt x = g->getQuota(); x <= g->getWeightSum(); ++x) {
-		for (longUInt y = 0; y < n; ++y) {
-			gCalculator->assign(cw(x, y), cc(x, y));
-		}
+		gCalculator->assign(&cw(x, 0), &cc(x, 0), n);
 	}
 
 	for (longUInt x = g->getWeightSum() - weights[p]; x >= g->getQuota(); --x) {
-		for (longUInt s = 1; s < n; ++s) {
-			gCalculator->minus(cw(x, n - s - 1), cc(x, n - s - 1), cw(x + weights[p], n - s));
+		if (weights[p] == 0) {
+			// each element depends on its (already calculated) neighbour in the same row
+			for (longUInt s = 1; s < n; ++s) {
+				gCalculator->minus(cw(x, n - s - 1), cc(x, n - s - 1), cw(x, n - s));
+			}
+		} else {
+			gCalculator->minus(&cw(x, 0), &cc(x, 0), &cw(x + weights[p], 1), n - 1);
 		}
 	}
 }
@@ -40,9 +57,19 @@ void epic::index::PowerIndexWithPrecoalitions::coalitionsCardinalityContainingPl
 void epic::index::PowerIndexWithPrecoalitions::generalizedBackwardCountingPerWeightCardinality(PrecoalitionGame* g, Array2dOffset<lint::LargeNumber>& cc, const std::vector<longUInt>& weights, longUInt n) {
 	for (longUInt i = 0; i < n; ++i) {
 		for (longUInt x = g->getQuota() + weights[i]; x <= g->getWeightSum(); ++x) {
-			for (longUInt m = 1; m < n; ++m) {
-				gCalculator->plusEqual(cc(x - weights[i], m - 1), cc(x, m));
-			}
+			gCalculator->plusEqual(&cc(x - weights[i], 0), &cc(x, 1), n - 1);
 		}
 	}
 }
+
+std::vector<epic::longUInt> epic::index::PowerIndexWithPrecoalitions::precoalitionsBySize(PrecoalitionGame* g) {
+	std::vector<longUInt> order(g->getNumberOfPrecoalitions());
+	std::iota(order.begin(), order.end(), 0);
+
+	const auto& precoalitions = g->getPrecoalitions();
+	std::stable_sort(order.begin(), order.end(), [&precoalitions](longUInt a, longUInt b) {
+		return precoalitions[a].size() > precoalitions[b].size();
+	});
+
+	return order;
+}
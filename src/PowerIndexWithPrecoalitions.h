@@ -59,6 +59,16 @@ protected:
 	 * @param n player amount
 	 */
 	void generalizedBackwardCountingPerWeightCardinality(PrecoalitionGame* g, Array2dOffset<lint::LargeNumber>& cc, const std::vector<longUInt>& weights, longUInt n);
+
+	/**
+	 * Getting the precoalition indices ordered by decreasing size
+	 *
+	 * The internal games of larger precoalitions are more expensive. Processing them first (see Parallel::for_each()) keeps the threads busy until the end.
+	 *
+	 * @param g The Game object for the current calculation
+	 * @return The precoalition indices. Precoalitions of the same size keep their original order.
+	 */
+	std::vector<longUInt> precoalitionsBySize(PrecoalitionGame* g);
 };
 
 } /* namespace epic::index */
@@ -1,6 +1,9 @@
 #include "PowerIndexWithWinningCoalitions.h"
 
 #include "GlobalCalculator.h"
+#include "Parallel.h"
+
+#include <algorithm>
 
 void epic::index::PowerIndexWithWinningCoalitions::numberOfWinningCoalitionsPerWeight(Game* g, ArrayOffset<lint::LargeNumber>& n_wc) {
 	// initialize the grand coalition (weight == weightsum) with 1, since it is always winning
@@ -22,15 +25,46 @@ void epic::index::PowerIndexWithWinningCoalitions::numberOfWinningCoalitionsPerW
 		 * This works by adding the number of winning coalitions of weight k to the number of possible winning
 		 * coalitions of weight k - wi (we know that subtracting player i's weight does not turn the coalition
 		 * losing, since we started at quota + wi, ensuring that).
+		 *
+		 * Since the loop runs in ascending order, each n_wc[k] gets read before it gets modified, i.e. n_wc[k - wi] += n_wc[k] only depends on values from before the pass of player i. Therefore each block of wi consecutive values (and every range of the array if its following wi old values are known) can get updated independently.
 		 */
-		for (longUInt k = g->getQuota() + wi; k <= g->getWeightSum(); ++k) {
-			gCalculator->plusEqual(n_wc[k - wi], n_wc[k]);
+		if (g->getQuota() + wi > g->getWeightSum()) { // veto player: no coalition stays winning without player i
+			continue;
+		}
+
+		longUInt length = (g->getWeightSum() + 1) - (g->getQuota() + wi); // number of updated values
+		longUInt number_of_chunks = Parallel::getNumberOfThreads(length / std::max(wi, cMinChunkSize), wi * gCalculator->getLargeNumberSize());
+
+		if (number_of_chunks <= 1) {
+			gCalculator->plusEqual(&n_wc[g->getQuota()], &n_wc[g->getQuota() + wi], length);
+		} else {
+			// split the range into wi-aligned chunks, each one processed by its own thread
+			longUInt chunk_size = ((length / number_of_chunks + wi - 1) / wi) * wi;
+			number_of_chunks = (length + chunk_size - 1) / chunk_size;
+
+			// the first wi values of each chunk are read by the preceding chunk. Save their old values before any chunk gets modified.
+			ArrayOffset<lint::LargeNumber> boundaries(number_of_chunks * wi, 0);
+			gCalculator->alloc_largeNumberArray(boundaries.getArrayPointer(), boundaries.getNumberOfElements());
+			for (longUInt c = 1; c < number_of_chunks; ++c) {
+				gCalculator->assign(&boundaries[(c - 1) * wi], &n_wc[g->getQuota() + c * chunk_size], wi);
+			}
+
+			Parallel::for_each(number_of_chunks, number_of_chunks, [&](longUInt, longUInt c) {
+				longUInt begin = g->getQuota() + c * chunk_size;
+
+				if (c + 1 == number_of_chunks) { // the last chunk only reads values no chunk modifies
+					gCalculator->plusEqual(&n_wc[begin], &n_wc[begin + wi], g->getQuota() + length - begin);
+				} else {
+					gCalculator->plusEqual(&n_wc[begin], &n_wc[begin + wi], chunk_size - wi);
+					gCalculator->plusEqual(&n_wc[begin + chunk_size - wi], &boundaries[c * wi], wi);
+				}
+			});
+
+			gCalculator->free_largeNumberArray(boundaries.getArrayPointer());
 		}
 	}
 }
 
 void epic::index::PowerIndexWithWinningCoalitions::numberOfWinningCoalitions(Game* g, ArrayOffset<lint::LargeNumber>& n_wc, lint::LargeNumber& total_wc) {
-	for (longUInt i = g->getQuota(); i <= g->getWeightSum(); ++i) {
-		gCalculator->plusEqual(total_wc, n_wc[i]);
-	}
+	gCalculator->plusEqualSum(total_wc, &n_wc[g->getQuota()], g->getWeightSum() + 1 - g->getQuota());
 }
@@ -8,6 +8,11 @@ namespace epic::index {
 
 class PowerIndexWithWinningCoalitions : public ItfPowerIndex {
 protected:
+	/**
+	 * The minimum number of values per thread when splitting the pass of a single player in numberOfWinningCoalitionsPerWeight() onto multiple threads. Smaller ranges are not worth the overhead of starting the threads.
+	 */
+	static constexpr longUInt cMinChunkSize = 1 << 16;
+
 	/**
 	 * Calculating the number of winning coalitions for each players weight.
 	 *
@@ -17,6 +22,8 @@ protected:
 	 *
 	 * @param g The Game object for the current calculation
 	 * @param n_wc An array of ChineseNumbers to store the calculation results. This array must be allocated and zero initialized at least in the range [quota, weightsum]!
+	 *
+	 * @note The pass of each player is done with a single span operation of gCalculator. Very long weight ranges get split into wi-aligned chunks processed by multiple threads.
 	 */
 	void numberOfWinningCoalitionsPerWeight(Game* g, ArrayOffset<lint::LargeNumber>& n_wc);
 
@@ -17,6 +17,18 @@ epic::lint::PrimesInfo epic::lint::PrimeCalculatorAddition::getPrimes(bigInt max
 		}
 	}
 
+	// prefer the primes leaving headroom if they suffice with the same number of primes
+	if (n_primes > 0) {
+		bigInt max_val_headroom = bigInt("1");
+		for (size_t i = 0; i < n_primes; ++i) {
+			max_val_headroom *= bigInt(mPrecPrimesHeadroom.array[i]);
+		}
+
+		if (max_val_headroom > max_value) {
+			return PrimesInfo{mPrecPrimesHeadroom.array, n_primes, max_val_headroom, true};
+		}
+	}
+
 	// not enough precalculated primes, calculate as much as needed
 	if (n_primes == 0) {
 		// copy current primes to vector
@@ -13,11 +13,32 @@ namespace epic::lint {
  * A specialized class to calculate primes used for the Chinese Remainder Theorem if only the addition and subtraction operation is needed.
  *
  * @remark The reason to use two separate classes instead of only change the max_value is, that this class also encapsulates the pre-calculated primes for addition/subtraction.
+ *
+ * There are two sets of precalculated primes: the largest ones (about 2^(longUInt::digits - 1)) and ones leaving cHeadroomBits bits of headroom. The latter allow ChineseRemainder to add up about 2^cHeadroomBits residues before reducing them (see ChineseRemainder::plusEqualSum()). getPrimes() only chooses them if they do not need more primes than the largest ones.
  */
 class PrimeCalculatorAddition : public ItfPrimeCalculator {
 public:
 	PrimesInfo getPrimes(bigInt max_value) override;
 
+	/**
+	 * Getting the first precalculated primes at compile time (see ChineseRemainderFixed). These are the primes getPrimes() returns if n_primes primes are needed (and the primes leaving headroom would need more).
+	 *
+	 * @tparam n_primes The number of primes (at most mNPrecPrimes)
+	 * @return A StaticArray containing the first n_primes precalculated primes
+	 */
+	template<size_t n_primes> static constexpr StaticArray<longUInt, n_primes> getPrecalculatedPrimes() {
+		return getFirstPrimes<n_primes>(mPrecPrimes);
+	}
+
+	/**
+	 * The same for the precalculated primes leaving headroom, i.e. Headroom can get used in place of PrimeCalculatorAddition as the template argument of ChineseRemainderFixed.
+	 */
+	struct Headroom {
+		template<size_t n_primes> static constexpr StaticArray<longUInt, n_primes> getPrecalculatedPrimes() {
+			return getFirstPrimes<n_primes>(mPrecPrimesHeadroom);
+		}
+	};
+
 private:
 	/**
 	 * The number of precalculated primes
@@ -28,6 +49,29 @@ private:
 	 * An Array containing the precalculated primes
 	 */
 	static constexpr StaticArray<longUInt, mNPrecPrimes> mPrecPrimes = ItfPrimeCalculator::precalculate_primes<mNPrecPrimes>(static_cast<longUInt>(1) << (std::numeric_limits<longUInt>::digits - 1)); // largest_prime = 2^(longUInt::digits - 1)
+
+	/**
+	 * The number of bits the primes of mPrecPrimesHeadroom leave unused
+	 */
+	static constexpr size_t cHeadroomBits = 4;
+
+	/**
+	 * An Array containing the precalculated primes leaving cHeadroomBits bits of headroom
+	 */
+	static constexpr StaticArray<longUInt, mNPrecPrimes> mPrecPrimesHeadroom = ItfPrimeCalculator::precalculate_primes<mNPrecPrimes>(static_cast<longUInt>(1) << (std::numeric_limits<longUInt>::digits - cHeadroomBits)); // largest_prime = 2^(longUInt::digits - cHeadroomBits)
+
+	/**
+	 * @return The first n_primes primes of table
+	 */
+	template<size_t n_primes> static constexpr StaticArray<longUInt, n_primes> getFirstPrimes(const StaticArray<longUInt, mNPrecPrimes>& table) {
+		static_assert(n_primes <= mNPrecPrimes, "not enough precalculated primes");
+
+		auto primes = StaticArray<longUInt, n_primes>();
+		for (size_t i = 0; i < n_primes; ++i) {
+			primes.array[i] = table.array[i];
+		}
+		return primes;
+	}
 };
 
 } /* namespace epic::lint */
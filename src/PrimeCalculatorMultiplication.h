@@ -14,6 +14,22 @@ class PrimeCalculatorMultiplication : public ItfPrimeCalculator {
 public:
 	PrimesInfo getPrimes(bigInt max_value) override;
 
+	/**
+	 * Getting the first precalculated primes at compile time (see ChineseRemainderFixed). These are the primes getPrimes() returns if n_primes primes are needed.
+	 *
+	 * @tparam n_primes The number of primes (at most mNPrecPrimes)
+	 * @return A StaticArray containing the first n_primes precalculated primes
+	 */
+	template<size_t n_primes> static constexpr StaticArray<longUInt, n_primes> getPrecalculatedPrimes() {
+		static_assert(n_primes <= mNPrecPrimes, "not enough precalculated primes");
+
+		auto primes = StaticArray<longUInt, n_primes>();
+		for (size_t i = 0; i < n_primes; ++i) {
+			primes.array[i] = mPrecPrimes.array[i];
+		}
+		return primes;
+	}
+
 private:
 	/**
 	 * The number of precalculated primes
@@ -21,9 +21,7 @@ void epic::index::PublicGood::calculate(Game* g, std::vector<bigFloat>& solution
 		lint::LargeNumber mwc_sum;
 		gCalculator->allocInit_largeNumber(mwc_sum);
 
-		for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
-			gCalculator->plusEqual(mwc_sum, mwc[i]);
-		}
+		gCalculator->plusEqualSum(mwc_sum, mwc, g->getNumberOfNonZeroPlayers());
 
 		bigInt tmp;
 		gCalculator->to_bigInt(&tmp, mwc_sum);
@@ -0,0 +1,248 @@
+#include "PublicGoodSolver.h"
+
+#include "GlobalCalculator.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+epic::index::PublicGoodSolver::PublicGoodSolver()
+	: mWeightSum(0), mNumberOfNonZeroPlayers(0), mQuotaCapacity(0), mMwcCapacity(0) {
+	gCalculator->alloc_largeNumber(mTmp);
+}
+
+epic::index::PublicGoodSolver::~PublicGoodSolver() {
+	if (mQuotaCapacity > 0) {
+		gCalculator->free_largeNumberArray(mF.getArrayPointer());
+		gCalculator->free_largeNumberArray(mB.getArrayPointer());
+		gCalculator->free_largeNumberArray(mBHelper.getArrayPointer());
+	}
+	if (mMwcCapacity > 0) {
+		gCalculator->free_largeNumberArray(mMwc.getArrayPointer());
+	}
+	gCalculator->free_largeNumber(mTmp);
+}
+
+void epic::index::PublicGoodSolver::calculate(const std::vector<longUInt>& weights, longUInt quota, std::vector<bigFloat>& solution) {
+	minimalWinningCoalitions(weights, quota, quota);
+	normalize(0, solution);
+}
+
+void epic::index::PublicGoodSolver::calculate(const std::vector<longUInt>& weights, longUInt min_quota, longUInt max_quota, std::vector<std::vector<bigFloat>>& solutions) {
+	if (max_quota < min_quota) {
+		return;
+	}
+
+	minimalWinningCoalitions(weights, min_quota, max_quota);
+
+	if (solutions.size() < max_quota + 1 - min_quota) {
+		solutions.resize(max_quota + 1 - min_quota);
+	}
+	for (longUInt q = min_quota; q <= max_quota; ++q) {
+		normalize(q - min_quota, solutions[q - min_quota]);
+	}
+}
+
+epic::bigInt epic::index::PublicGoodSolver::getMemoryRequirement(longUInt number_of_players, longUInt max_quota, longUInt number_of_quotas) {
+	bigInt memory = bigInt(max_quota + 1) * 3 * gCalculator->getLargeNumberSize();				// f, b, b_helper
+	memory += bigInt(number_of_players) * number_of_quotas * gCalculator->getLargeNumberSize();	// mwc
+	memory += bigInt(number_of_players) * 4 * c_sizeof_longUInt;								// weights, order, sorted weights, changed weights
+	return memory;
+}
+
+void epic::index::PublicGoodSolver::sortPlayers(const std::vector<longUInt>& weights) {
+	auto heavier = [&weights](longUInt a, longUInt b) {
+		return weights[a] > weights[b];
+	};
+
+	bool updated = false;
+	if (weights.size() == mWeights.size()) {
+		mChanged.clear();
+		for (longUInt i = 0; i < weights.size() && mChanged.size() <= cMaxUpdatedWeights; ++i) {
+			if (weights[i] != mWeights[i]) {
+				mChanged.push_back(i);
+			}
+		}
+
+		if (mChanged.size() <= cMaxUpdatedWeights) {
+			// the unchanged players keep their relative order, only the changed ones get re-inserted
+			mOrder.erase(std::remove_if(mOrder.begin(), mOrder.end(), [this](longUInt i) {
+				return std::find(mChanged.begin(), mChanged.end(), i) != mChanged.end();
+			}), mOrder.end());
+
+			for (longUInt i : mChanged) {
+				mOrder.insert(std::upper_bound(mOrder.begin(), mOrder.end(), i, heavier), i);
+				mWeights[i] = weights[i];
+			}
+			updated = true;
+		}
+	}
+
+	if (!updated) {
+		mWeights = weights;
+		mOrder.resize(weights.size());
+		std::iota(mOrder.begin(), mOrder.end(), 0);
+		std::stable_sort(mOrder.begin(), mOrder.end(), heavier);
+	}
+
+	mSortedWeights.resize(weights.size());
+	mWeightSum = 0;
+	mNumberOfNonZeroPlayers = 0;
+	for (longUInt k = 0; k < weights.size(); ++k) {
+		mSortedWeights[k] = weights[mOrder[k]];
+		mWeightSum += mSortedWeights[k];
+		if (mSortedWeights[k] > 0) {
+			++mNumberOfNonZeroPlayers;
+		}
+	}
+}
+
+void epic::index::PublicGoodSolver::reserve(longUInt max_quota, longUInt mwc_size) {
+	if (max_quota > mQuotaCapacity) {
+		if (mQuotaCapacity > 0) {
+			gCalculator->free_largeNumberArray(mF.getArrayPointer());
+			gCalculator->free_largeNumberArray(mB.getArrayPointer());
+			gCalculator->free_largeNumberArray(mBHelper.getArrayPointer());
+			mF.free();
+			mB.free();
+			mBHelper.free();
+		}
+
+		mQuotaCapacity = max_quota;
+		mF.alloc(mQuotaCapacity, 0);
+		gCalculator->alloc_largeNumberArray(mF.getArrayPointer(), mF.getNumberOfElements());
+		mB.alloc(mQuotaCapacity + 1, 0);
+		gCalculator->alloc_largeNumberArray(mB.getArrayPointer(), mB.getNumberOfElements());
+		mBHelper.alloc(mQuotaCapacity + 1, 0);
+		gCalculator->alloc_largeNumberArray(mBHelper.getArrayPointer(), mBHelper.getNumberOfElements());
+	}
+
+	if (mwc_size > mMwcCapacity) {
+		if (mMwcCapacity > 0) {
+			gCalculator->free_largeNumberArray(mMwc.getArrayPointer());
+			mMwc.free();
+		}
+
+		mMwcCapacity = mwc_size;
+		mMwc.alloc(mMwcCapacity, 0);
+		gCalculator->alloc_largeNumberArray(mMwc.getArrayPointer(), mMwc.getNumberOfElements());
+	}
+}
+
+void epic::index::PublicGoodSolver::minimalWinningCoalitions(const std::vector<longUInt>& weights, longUInt min_quota, longUInt max_quota) {
+	sortPlayers(weights);
+
+	if (mWeightSum < max_quota) {
+		throw std::invalid_argument("The sum of all weights smaller than quota. Please, check your input.");
+	}
+
+	longUInt n = weights.size();
+	reserve(max_quota, (max_quota + 1 - min_quota) * n);
+	gCalculator->assign_zero(mMwc.getArrayPointer(), (max_quota + 1 - min_quota) * n);
+
+	/*
+	 * The values of f and b at index k do not depend on the quota as long as k is smaller (or equal) than the quota. Therefore the tables get calculated once for max_quota and each smaller quota just uses their prefixes.
+	 */
+	lint::LargeNumber* f = mF.getArrayPointer();
+	lint::LargeNumber* b = mB.getArrayPointer();
+	lint::LargeNumber* b_helper = mBHelper.getArrayPointer();
+
+	// f-vector (see RawPublicGood::calculateFVector())
+	gCalculator->assign_zero(f, max_quota);
+	gCalculator->assign_one(f[0]);
+	for (longUInt i = 0; i < mNumberOfNonZeroPlayers; ++i) {
+		longUInt wi = mSortedWeights[i];
+
+		for (longUInt end = (wi < max_quota) ? max_quota - wi : 0; end > 0;) {
+			longUInt begin = (end > wi) ? end - wi : 0;
+			gCalculator->plusEqual(&f[begin + wi], &f[begin], end - begin);
+			end = begin;
+		}
+	}
+
+	gCalculator->assign_zero(b, max_quota + 1);
+
+	// Last Player
+	{
+		longUInt last_player = mNumberOfNonZeroPlayers - 1;
+		longUInt w_last = mSortedWeights[last_player];
+
+		if (w_last < max_quota) {
+			for (longUInt k = 0; k <= w_last; ++k) {
+				gCalculator->assign_one(b[k]);
+			}
+
+			for (longUInt begin = w_last; begin < max_quota; begin += w_last) {
+				gCalculator->minus(&f[begin], &f[begin], &f[begin - w_last], std::min(w_last, max_quota - begin));
+			}
+		}
+
+		// for quotas up to w_last the last player is a veto player (handled below)
+		addMinimalWinningCoalitions(last_player, std::max(min_quota, w_last + 1), min_quota, max_quota);
+	}
+
+	// For each player (except the last one)
+	for (longUInt i = mNumberOfNonZeroPlayers - 2; i < mNumberOfNonZeroPlayers; --i) {
+		longUInt wi = mSortedWeights[i];
+		longUInt wi_plus1 = mSortedWeights[i + 1];
+
+		gCalculator->assign(b_helper, b, max_quota + 1);
+
+		for (longUInt k = 0; k <= wi && k <= max_quota; ++k) {
+			gCalculator->assign_one(b[k]);
+		}
+
+		if (wi < max_quota) {
+			for (longUInt begin = wi; begin < max_quota; begin += wi) {
+				gCalculator->minus(&f[begin], &f[begin], &f[begin - wi], std::min(wi, max_quota - begin));
+			}
+
+			for (longUInt k = wi + 1; k <= max_quota; ++k) {
+				gCalculator->plus(b[k], b_helper[k - wi + wi_plus1], b_helper[k - wi]);
+			}
+		}
+
+		// for quotas up to wi player i is a veto player (handled below)
+		addMinimalWinningCoalitions(i, std::max(min_quota, wi + 1), min_quota, max_quota);
+	}
+
+	// Handling veto players (weight >= quota): each one is only member of a single minimal winning coalition
+	for (longUInt q = min_quota; q <= max_quota; ++q) {
+		for (longUInt k = 0; k < mNumberOfNonZeroPlayers && mSortedWeights[k] >= q; ++k) {
+			gCalculator->assign(mMwc[(q - min_quota) * n + k], 1ul);
+		}
+	}
+}
+
+void epic::index::PublicGoodSolver::addMinimalWinningCoalitions(longUInt player, longUInt first_quota, longUInt min_quota, longUInt max_quota) {
+	longUInt n = mSortedWeights.size();
+
+	for (longUInt q = first_quota; q <= max_quota; ++q) {
+		// sum_{k = 0}^{q - 1} mF[k] * mB[q - k]
+		gCalculator->plusEqualConvolution(mMwc[(q - min_quota) * n + player], &mF[0], &mB[1], q);
+	}
+}
+
+void epic::index::PublicGoodSolver::normalize(longUInt row, std::vector<bigFloat>& solution) {
+	longUInt n = mSortedWeights.size();
+	lint::LargeNumber* mwc = &mMwc[row * n];
+
+	bigFloat big_mwc_sum;
+	bigInt big_tmp;
+	{
+		gCalculator->assign_zero(mTmp);
+		gCalculator->plusEqualSum(mTmp, mwc, mNumberOfNonZeroPlayers);
+		gCalculator->to_bigInt(&big_tmp, mTmp);
+		big_mwc_sum = big_tmp;
+	}
+
+	solution.resize(n);
+	for (longUInt k = 0; k < mNumberOfNonZeroPlayers; ++k) {
+		gCalculator->to_bigInt(&big_tmp, mwc[k]);
+		solution[mOrder[k]] = big_tmp;
+		solution[mOrder[k]] /= big_mwc_sum;
+	}
+	for (longUInt k = mNumberOfNonZeroPlayers; k < n; ++k) {
+		solution[mOrder[k]] = 0;
+	}
+}
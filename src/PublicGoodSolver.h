@@ -0,0 +1,138 @@
+#ifndef EPIC_INDEX_PUBLICGOODSOLVER_H_
+#define EPIC_INDEX_PUBLICGOODSOLVER_H_
+
+#include "Array.h"
+#include "LargeNumber.h"
+#include "types.h"
+
+#include <vector>
+
+namespace epic::index {
+
+/**
+ * A reusable context to calculate the <i>Public Good</i> index (see PublicGood) of many small sub-games, e.g. the internal and external games of the indices with precoalitions.
+ *
+ * Creating a Game object and a PublicGood object per sub-game sorts the weights, searches the null players and allocates all LargeNumber tables again and again. This class works directly on a weight vector instead:
+ * - The helper tables are kept across calls and only get reallocated if a larger quota (or more quotas) is requested.
+ * - The players get ordered by decreasing weight. If the weight vector only differs in a few entries from the one of the previous call, only those players get re-inserted into the previous order instead of sorting all players again.
+ * - The minimal winning coalitions for a whole range of quotas get counted by a single pass over the players (see calculate(const std::vector<longUInt>&, longUInt, longUInt, std::vector<std::vector<bigFloat>>&)).
+ *
+ * The results are identical to the ones of PublicGood::calculate() for a Game object created from the same weights and quota (without filtering null players).
+ *
+ * @note The helper tables get allocated using gCalculator. Therefore a PublicGoodSolver object must get deleted before gCalculator gets removed.
+ */
+class PublicGoodSolver {
+public:
+	PublicGoodSolver();
+	~PublicGoodSolver();
+
+	/**
+	 * Calculating the Public Good index of the weighted game [quota; weights]
+	 *
+	 * @param weights The player weights (in any order)
+	 * @param quota The quota of the game (at least 1)
+	 * @param solution Return vector the solution will be stored in. It gets resized to weights.size() elements and uses the order of weights.
+	 *
+	 * @throws std::invalid_argument if the sum of all weights is smaller than the quota
+	 */
+	void calculate(const std::vector<longUInt>& weights, longUInt quota, std::vector<bigFloat>& solution);
+
+	/**
+	 * Calculating the Public Good index of the weighted games [q; weights] for all quotas q in the range [min_quota, max_quota]
+	 *
+	 * All quotas share the f-vector and the per player passes, only the final summation is done per quota.
+	 *
+	 * @param weights The player weights (in any order)
+	 * @param min_quota The smallest quota (at least 1)
+	 * @param max_quota The largest quota. If it is smaller than min_quota (e.g. a precoalition of weight 0), nothing gets calculated.
+	 * @param solutions Return vectors: solutions[q - min_quota] contains the solution for quota q (see calculate(const std::vector<longUInt>&, longUInt, std::vector<bigFloat>&)). If solutions contains less than max_quota - min_quota + 1 elements it gets resized.
+	 *
+	 * @throws std::invalid_argument if the sum of all weights is smaller than max_quota
+	 */
+	void calculate(const std::vector<longUInt>& weights, longUInt min_quota, longUInt max_quota, std::vector<std::vector<bigFloat>>& solutions);
+
+	/**
+	 * Getting the memory the helper tables need
+	 *
+	 * @param number_of_players The maximum number of players of a sub-game
+	 * @param max_quota The largest quota of a sub-game
+	 * @param number_of_quotas The maximum number of quotas calculated at once
+	 * @return The memory requirement in Bytes
+	 */
+	static bigInt getMemoryRequirement(longUInt number_of_players, longUInt max_quota, longUInt number_of_quotas = 1);
+
+private:
+	/**
+	 * The maximum number of changed weights for which the previous player order gets updated instead of sorting all players again
+	 */
+	static constexpr longUInt cMaxUpdatedWeights = 4;
+
+	/**
+	 * The weights of the previous call (in their original order)
+	 */
+	std::vector<longUInt> mWeights;
+
+	/**
+	 * mOrder[k]: the index (in mWeights) of the player with the k-th largest weight
+	 */
+	std::vector<longUInt> mOrder;
+
+	/**
+	 * mSortedWeights[k] = mWeights[mOrder[k]]
+	 */
+	std::vector<longUInt> mSortedWeights;
+
+	/**
+	 * Indices of the weights that changed since the previous call
+	 */
+	std::vector<longUInt> mChanged;
+
+	longUInt mWeightSum;
+	longUInt mNumberOfNonZeroPlayers;
+
+	/**
+	 * The f-vector (quota capacity elements), the b-vector and its copy (quota capacity + 1 elements each)
+	 */
+	ArrayOffset<lint::LargeNumber> mF, mB, mBHelper;
+	longUInt mQuotaCapacity;
+
+	/**
+	 * The number of minimal winning coalitions per quota (row) and player (column, in the order of mOrder)
+	 */
+	ArrayOffset<lint::LargeNumber> mMwc;
+	longUInt mMwcCapacity;
+
+	lint::LargeNumber mTmp;
+
+	/**
+	 * Updating mWeights, mOrder, mSortedWeights, mWeightSum and mNumberOfNonZeroPlayers for new weights
+	 */
+	void sortPlayers(const std::vector<longUInt>& weights);
+
+	/**
+	 * Making sure the helper tables are large enough
+	 *
+	 * @param max_quota The largest quota
+	 * @param mwc_size The number of elements of mMwc
+	 */
+	void reserve(longUInt max_quota, longUInt mwc_size);
+
+	/**
+	 * Counting the minimal winning coalitions per player for all quotas in [min_quota, max_quota] (see RawPublicGood::calculateMinimalWinningCoalitionsPerPlayer() for the single quota version).
+	 */
+	void minimalWinningCoalitions(const std::vector<longUInt>& weights, longUInt min_quota, longUInt max_quota);
+
+	/**
+	 * mwc(q, player) += sum_{k < q} f[k] * b[q - k] for all quotas q in [first_quota, max_quota]
+	 */
+	void addMinimalWinningCoalitions(longUInt player, longUInt first_quota, longUInt min_quota, longUInt max_quota);
+
+	/**
+	 * Converting the row of mMwc belonging to a single quota into the Public Good index
+	 */
+	void normalize(longUInt row, std::vector<bigFloat>& solution);
+};
+
+} /* namespace epic::index */
+
+#endif /* EPIC_INDEX_PUBLICGOODSOLVER_H_ */
@@ -22,7 +22,7 @@ std::vector<epic::bigFloat> epic::index::PublicHelpTheta::calculate(Game* g) {
 	std::vector<bigFloat> solution(g->getNumberOfPlayers());
 	{
 		if (log::out.getLogLevel() <= log::info) {
-			bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0(); // additional winning coalitions due to players of weight 0
+			bigInt factor = coalitionsOfPlayersWithWeight0(g); // additional winning coalitions due to players of weight 0
 
 			log::out << log::info << "Number of winning coalitions a player belongs to: " << log::endl;
 
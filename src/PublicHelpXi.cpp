@@ -1,8 +1,10 @@
 #include "PublicHelpXi.h"
 
+#include "CardinalityWeightedSum.h"
 #include "Logging.h"
 #include "GlobalCalculator.h"
 
+#include <algorithm>
 #include <iostream>
 
 epic::index::PublicHelpXi::PublicHelpXi(Game* g)
@@ -15,103 +17,81 @@ epic::index::PublicHelpXi::PublicHelpXi(Game* g)
 std::vector<epic::bigFloat> epic::index::PublicHelpXi::calculate(Game* g) {
 	// helper variables to avoid multiple allocation/deallocation cycles due to frequent use.
 	bigInt tmp_bigInt;
-	bigFloat tmp_bigFloat;
+	longUInt n = g->getNumberOfNonZeroPlayers();
+	longUInt n_weight0 = g->getNumberOfPlayersWithWeight0();
 
-	// n_wc(x, y) => n_wc[x][y]: number of winning coalitions of weight x and cardinality y
-	Array2dOffset<lint::LargeNumber> n_wc(g->getWeightSum() + 1, g->getNumberOfPlayers() + 1, g->getQuota(), 0);
+	/*
+	 * The players of weight 0 are excluded from the tables: n_wc and wci only cover the cardinalities of the non-zero players. The weights 1/p and 1/p^2 of the final summations get folded over the players of weight 0 instead (see cardinalityWeightsWithPlayersOfWeight0()).
+	 */
+	std::vector<bigFloat> inverse(g->getNumberOfPlayers() + 1), inverse_square(g->getNumberOfPlayers() + 1);
+	for (longUInt p = 1; p <= g->getNumberOfPlayers(); ++p) {
+		inverse[p] = 1 / bigFloat(p);
+		inverse_square[p] = inverse[p] * inverse[p];
+	}
+
+	// n_wc(x, y) => n_wc[x][y]: number of winning coalitions of weight x and cardinality y (players of weight 0 excluded)
+	Array2dOffset<lint::LargeNumber> n_wc(g->getWeightSum() + 1, n + 1, g->getQuota(), 0);
 	gCalculator->allocInit_largeNumberArray(n_wc.getArrayPointer(), n_wc.getNumberOfElements());
 	numberOfWinningCoalitionsPerWeightAndCardinality(g, n_wc);
 
-	// wci(x, y): number of times player x is a swing player in a coalition of cardinality y (= absolute ShapleyShubik index)
-	Array2d<lint::LargeNumber> wci(g->getNumberOfPlayers(), g->getNumberOfPlayers() + 1);
+	// wci(x, y): number of winning coalitions of cardinality y player x is a member of (players of weight 0 excluded)
+	Array2d<lint::LargeNumber> wci(n, n + 1);
 	gCalculator->allocInit_largeNumberArray(wci.getArrayPointer(), wci.getNumberOfElements());
 	swingsPerPlayerAndCardinality(g, n_wc, wci, false);
 
-	// Update n_wc and wci if there are players of weights 0
-	for (longUInt count = 0; count < g->getNumberOfPlayersWithWeight0(); ++count) {
-		// n_wc:
-		for (longUInt weight = g->getQuota(); weight <= g->getWeightSum(); ++weight) {
-			for (longUInt cardinality = g->getNumberOfPlayers(); cardinality > 1; --cardinality) {
-				gCalculator->plusEqual(n_wc(weight, cardinality), n_wc(weight, cardinality - 1));
-				// When a player of weight 0 joins a coalition, the weight stays unchanged while the cardinality increases.
-			}
-		}
+	// n_wc_c[c]: number of winning coalitions of cardinality c
+	std::vector<bigFloat> n_wc_c(n + 1);
+	{
+		lint::LargeNumber tmp;
+		gCalculator->alloc_largeNumber(tmp);
 
-		// wci:
-		for (longUInt player = 0; player < g->getNumberOfNonZeroPlayers(); ++player) {
-			for (longUInt cardinality = g->getNumberOfPlayers(); cardinality > 1; --cardinality) {
-				gCalculator->plusEqual(wci(player, cardinality), wci(player, cardinality - 1));
-				// If a player is a swing player in a coalitions with (cardinality - 1) players, then he is also a swing player in that coalition if a player of weight zero joins. This new coalition has (cardinality) players.
-			}
+		for (longUInt c = 1; c <= n; ++c) {
+			gCalculator->assign_zero(tmp);
+			gCalculator->plusEqualSum(tmp, &n_wc(g->getQuota(), c), g->getWeightSum() + 1 - g->getQuota(), n + 1); // column c of n_wc
+
+			gCalculator->to_bigInt(&tmp_bigInt, tmp);
+			n_wc_c[c] = tmp_bigInt;
 		}
+
+		gCalculator->free_largeNumber(tmp);
 	}
 
 	/*
-	 * initialize the power indices for each player
+	 * calculate the power index of player of weight greater than 0
 	 */
 	std::vector<bigFloat> solution(g->getNumberOfPlayers());
-	for (longUInt i = 0; i < g->getNumberOfPlayers(); ++i) {
-		for (longUInt p = 1; p <= g->getNumberOfPlayers(); ++p) {
-			gCalculator->to_bigInt(&tmp_bigInt, wci(i, p));
-			tmp_bigFloat = (p * p); // TODO: overflow ??? -> gmp function
-			tmp_bigFloat = tmp_bigInt / tmp_bigFloat;
-			solution[i] += tmp_bigFloat;
-		}
+	{
+		std::vector<bigFloat> h = cardinalityWeightsWithPlayersOfWeight0(inverse_square, n_weight0);
+
+		std::vector<bigFloat> sums;
+		CardinalityWeightedSum::weightedSum(wci, n, n, h, sums);
+		std::copy(sums.begin(), sums.end(), solution.begin());
 	}
 
 	/*
-	 * calculate the power index of player of weight 0
+	 * calculate the power index of player of weight 0: Each winning coalition of cardinality c (without the players of weight 0) gets joined by player i and any subset of the remaining players of weight 0.
 	 */
-	{
-		lint::LargeNumber numerator;
-		gCalculator->alloc_largeNumber(numerator);
-
-		for (longUInt i = g->getNumberOfNonZeroPlayers(); i < g->getNumberOfPlayers(); ++i) {
-			for (longUInt k = g->getQuota(); k <= g->getWeightSum(); ++k) {
-				for (longUInt p = 1; p <= g->getNumberOfPlayers(); ++p) {
-					gCalculator->plusEqual(wci(i, p), n_wc(k, p));
-				}
-			}
-
-			gCalculator->assign_zero(numerator);
-			for (longUInt p = 2; p <= g->getNumberOfPlayers(); ++p) {
-				gCalculator->minus(numerator, wci(i, p - 1), numerator);
-
-				gCalculator->to_bigInt(&tmp_bigInt, numerator);
-				tmp_bigFloat = (p * p); // TODO: overflow? --> gmp function
-				tmp_bigFloat = tmp_bigInt / tmp_bigFloat;
-				solution[i] += tmp_bigFloat;
-			}
+	if (n_weight0 > 0) {
+		std::vector<bigFloat> h = cardinalityWeightsWithPlayersOfWeight0(std::vector<bigFloat>(inverse_square.begin() + 1, inverse_square.end()), n_weight0 - 1);
+
+		bigFloat value;
+		for (longUInt c = 1; c <= n; ++c) {
+			value += h[c] * n_wc_c[c];
 		}
 
-		gCalculator->free_largeNumber(numerator);
+		for (longUInt i = n; i < g->getNumberOfPlayers(); ++i) {
+			solution[i] = value;
+		}
 	}
 
-	/*
-	 * calculate the power index of player of weight greater than 0
-	 */
-	// siwcc: sum of the multiplicative inverse for the cardinality for each coalition in winning coalitions. Starting with the multiplicative inverse for the cardinality of the grand coalition because it is always winning.
-	double siwcc = 0; // 1.0 / g->getNumberOfPlayers()
+	// siwcc: sum of the multiplicative inverse for the cardinality for each coalition in winning coalitions
+	bigFloat siwcc;
 	{
-		// wci: number of winning coalitions a certain player belongs to
-		lint::LargeNumber n_wc_i;
-		gCalculator->alloc_largeNumber(n_wc_i);
-
-		for (longUInt i = 1; i <= g->getNumberOfPlayers(); ++i) {
-			gCalculator->assign_zero(n_wc_i);
-
-			// summing up the number of winning coalitions player i belongs to
-			for (longUInt k = g->getQuota(); k <= g->getWeightSum(); ++k) {
-				gCalculator->plusEqual(n_wc_i, n_wc(k, i));
-			}
-
-			gCalculator->to_bigInt(&tmp_bigInt, n_wc_i);
-			tmp_bigFloat = i;
-			tmp_bigFloat = tmp_bigInt / tmp_bigFloat;
-			siwcc += tmp_bigFloat.get_d();
-		}
+		std::vector<bigFloat> h = cardinalityWeightsWithPlayersOfWeight0(inverse, n_weight0);
 
-		gCalculator->free_largeNumber(n_wc_i);
+		for (longUInt c = 1; c <= n; ++c) {
+			siwcc += h[c] * n_wc_c[c];
+		}
 	}
 
 	for (longUInt i = 0; i < g->getNumberOfPlayers(); ++i) {
@@ -132,7 +112,7 @@ std::string epic::index::PublicHelpXi::getFullName() {
 }
 
 epic::longUInt epic::index::PublicHelpXi::getMemoryRequirement(Game* g) {
-	bigInt memory = g->getNumberOfPlayers() * (g->getNumberOfPlayers() + 1) * gCalculator->getLargeNumberSize(); // wci
+	bigInt memory = g->getNumberOfNonZeroPlayers() * (g->getNumberOfNonZeroPlayers() + 1) * gCalculator->getLargeNumberSize(); // wci
 	memory /= cMemUnit_factor;
 
 	memory += SwingsPerPlayerAndCardinality::getMemoryRequirement(g);
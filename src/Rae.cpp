@@ -24,7 +24,7 @@ std::vector<epic::bigFloat> epic::index::Rae::calculate(Game* g) {
 		bigFloat gamma = 0.5;
 
 		if (log::out.getLogLevel() <= log::info) {
-			bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0();
+			bigInt factor = coalitionsOfPlayersWithWeight0(g);
 
 			log::out << log::info << "Number of times each player is a swing player:" << log::endl;
 
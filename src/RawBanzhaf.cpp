@@ -1,7 +1,11 @@
 #include "RawBanzhaf.h"
 
 #include "GlobalCalculator.h"
+#include "MeetInTheMiddle.h"
+#include "SmallGame.h"
+#include "SparseCoalitions.h"
 
+#include <algorithm>
 #include <iostream>
 
 epic::index::RawBanzhaf::RawBanzhaf()
@@ -17,7 +21,7 @@ std::vector<epic::bigFloat> epic::index::RawBanzhaf::calculate(Game* g) {
 	std::vector<bigFloat> solution(g->getNumberOfPlayers());
 	{
 		bigInt tmp;
-		bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0(); // additional winning coalitions due to players of weight 0
+		bigInt factor = coalitionsOfPlayersWithWeight0(g); // additional winning coalitions due to players of weight 0
 
 		for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
 			gCalculator->to_bigInt(&tmp, n_sp[i]);
@@ -43,7 +47,18 @@ std::string epic::index::RawBanzhaf::getFullName() {
 
 epic::longUInt epic::index::RawBanzhaf::getMemoryRequirement(Game* g) {
 	bigInt memory = g->getNumberOfNonZeroPlayers() * gCalculator->getLargeNumberSize();		   // n_sp;
-	memory += (g->getWeightSum() + 1 - g->getQuota()) * gCalculator->getLargeNumberSize() * 2; // n_wc + helper
+	if (SmallGame::isPreferable(g, g->getWeightSum() + 1 - g->getQuota(), 1)) {
+		memory += SmallGame::getMemoryRequirement(g, 1);
+	} else if (MeetInTheMiddle::isPreferable(g, g->getWeightSum() + 1 - g->getQuota())) {
+		memory += MeetInTheMiddle::getMemoryRequirement(g, 1);
+	} else if (SparseCoalitions::isPreferable(g, g->getWeightSum() + 1 - g->getQuota())) {
+		memory += SparseCoalitions::getMemoryRequirement(g, 1);
+	} else {
+		memory += (g->getWeightSum() + 1 - g->getQuota()) * gCalculator->getLargeNumberSize() * 2; // n_wc + suffix
+		if (g->getWeights()[g->getNumberOfNonZeroPlayers() - 1] < cMinWindowWeight) {
+			memory += (g->getWeightSum() + 1 - g->getQuota()) * gCalculator->getLargeNumberSize(); // helper
+		}
+	}
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
@@ -63,6 +78,24 @@ epic::lint::Operation epic::index::RawBanzhaf::getOperationRequirement() {
 }
 
 void epic::index::RawBanzhaf::numberOfTimesPlayerIsSwingPlayer(Game* g, lint::LargeNumber n_sp[]) {
+	// committee-sized games: the dynamic programs would process more weights than there are coalitions
+	if (SmallGame::isPreferable(g, g->getWeightSum() + 1 - g->getQuota(), 1)) {
+		SmallGame::swingsPerPlayer(g, n_sp);
+		return;
+	}
+
+	// the table would be large compared to the coalitions of half the players
+	if (MeetInTheMiddle::isPreferable(g, g->getWeightSum() + 1 - g->getQuota())) {
+		MeetInTheMiddle::swingsPerPlayer(g, n_sp);
+		return;
+	}
+
+	// only a few coalition weights are reachable compared to the table size (e.g. very large weights)
+	if (SparseCoalitions::isPreferable(g, g->getWeightSum() + 1 - g->getQuota())) {
+		SparseCoalitions::swingsPerPlayer(g, n_sp);
+		return;
+	}
+
 	// n_wc[x]: number of winning coalitions of weight x.
 	ArrayOffset<lint::LargeNumber> n_wc(g->getWeightSum() + 1, g->getQuota());
 	gCalculator->allocInit_largeNumberArray(n_wc.getArrayPointer(), n_wc.getNumberOfElements());
@@ -74,13 +107,53 @@ void epic::index::RawBanzhaf::numberOfTimesPlayerIsSwingPlayer(Game* g, lint::La
 }
 
 void epic::index::RawBanzhaf::numberOfTimesPlayerIsSwingPlayer(Game* g, ArrayOffset<lint::LargeNumber>& n_wc, lint::LargeNumber n_sp[]) {
-	// helper: helper array for n_wc
-	ArrayOffset<lint::LargeNumber> helper(g->getWeightSum() + 1, g->getQuota());
-	gCalculator->alloc_largeNumberArray(helper.getArrayPointer(), helper.getNumberOfElements());
+	/*
+	 * suffix[k]: number of winning coalitions of weight >= k (suffix[weightsum + 1] = 0)
+	 *
+	 * The number of winning coalitions of weight k containing player i is h(k) = n_wc[k] - h(k + wi) = sum_j (-1)^j * n_wc[k + j * wi]. Summing up this alternating sum over the window [quota, quota + wi) only needs the block sums of the blocks [quota + j * wi, quota + (j + 1) * wi), i.e.
+	 *
+	 * sum_{k = quota}^{quota + wi - 1} h(k) = sum_j (-1)^j * (suffix[quota + j * wi] - suffix[quota + (j + 1) * wi])
+	 *
+	 * This needs (weightsum - quota) / wi operations on single LargeNumbers instead of a pass over the whole range [quota, weightsum]. The even and the odd blocks get summed up separately such that no intermediate value gets negative.
+	 */
+	ArrayOffset<lint::LargeNumber> suffix(g->getWeightSum() + 2, g->getQuota());
+	gCalculator->allocInit_largeNumberArray(suffix.getArrayPointer(), suffix.getNumberOfElements());
+	for (longUInt k = g->getWeightSum(); k >= g->getQuota(); --k) {
+		gCalculator->plus(suffix[k], suffix[k + 1], n_wc[k]);
+	}
+
+	lint::LargeNumber even, odd;
+	gCalculator->alloc_largeNumber(even);
+	gCalculator->alloc_largeNumber(odd);
+
+	// helper: helper array for n_wc (only needed for the players using the complete pass, i.e. the ones lighter than cMinWindowWeight)
+	ArrayOffset<lint::LargeNumber> helper;
+	if (g->getWeights()[g->getNumberOfNonZeroPlayers() - 1] < cMinWindowWeight) {
+		helper.alloc(g->getWeightSum() + 1, g->getQuota());
+		gCalculator->alloc_largeNumberArray(helper.getArrayPointer(), helper.getNumberOfElements());
+	}
 
 	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
 		// wi: weight of player i (the current player)
-		int wi = g->getWeights()[i];
+		longUInt wi = g->getWeights()[i];
+
+		if (wi >= cMinWindowWeight) {
+			gCalculator->assign_zero(even);
+			gCalculator->assign_zero(odd);
+
+			bool is_even = true;
+			for (longUInt begin = g->getQuota(); begin <= g->getWeightSum(); begin += wi) {
+				longUInt end = std::min(begin + wi, g->getWeightSum() + 1);
+				lint::LargeNumber& block_sum = is_even ? even : odd;
+				gCalculator->plusEqual(block_sum, suffix[begin]);
+				gCalculator->minusEqual(block_sum, suffix[end]);
+				is_even = !is_even;
+			}
+
+			gCalculator->minusEqual(even, odd);
+			gCalculator->plusEqual(n_sp[i], even);
+			continue;
+		}
 
 		// quota - 1 is the maximum only if i is a veto player
 		longUInt m = std::max(g->getWeightSum() - wi, g->getQuota() - 1);
@@ -88,9 +161,7 @@ void epic::index::RawBanzhaf::numberOfTimesPlayerIsSwingPlayer(Game* g, ArrayOff
 		 * Initialize helper array bz_helper for the values from weight sum to weightsum - wi + 1.
 		 * bz_helper[x]: number of winning coalitions containing player x.
 		 */
-		for (longUInt k = g->getWeightSum(); k > m; --k) {
-			gCalculator->assign(helper[k], n_wc[k]);
-		}
+		gCalculator->assign(&helper[m + 1], &n_wc[m + 1], g->getWeightSum() - m);
 
 		/*
 		 * Filter out all winning coalitions which player is not a member of, since those coalitions cannot be turned
@@ -108,9 +179,14 @@ void epic::index::RawBanzhaf::numberOfTimesPlayerIsSwingPlayer(Game* g, ArrayOff
 		 *
 		 * Then bz_helper[k + wi] gets added to bz_helper[k] representing the number of winning coalitions that
 		 * player i is a member of.
+		 *
+		 * The values of a block of wi consecutive weights only depend on the block above, i.e. each block is a single
+		 * span operation.
 		 */
-		for (longUInt k = g->getWeightSum() - wi; k >= g->getQuota(); --k) {
-			gCalculator->minus(helper[k], n_wc[k], helper[k + wi]);
+		for (longUInt end = g->getWeightSum() + 1 - wi; end > g->getQuota();) {
+			longUInt begin = (end - g->getQuota() > wi) ? end - wi : g->getQuota();
+			gCalculator->minus(&helper[begin], &n_wc[begin], &helper[begin + wi], end - begin);
+			end = begin;
 		}
 
 		/*
@@ -118,17 +194,17 @@ void epic::index::RawBanzhaf::numberOfTimesPlayerIsSwingPlayer(Game* g, ArrayOff
 		 * + wi - 1. Subtracting the weight of player i from any of those coalitions would turn them into a losing one.
 		 */
 		m = std::min(g->getQuota() + wi, g->getWeightSum() + 1);
-		for (longUInt k = g->getQuota(); k < m; ++k) {
-			// Add all the values to get the amount how often player i is a swing player
-			gCalculator->plusEqual(n_sp[i], helper[k]);
-		}
+		gCalculator->plusEqualSum(n_sp[i], &helper[g->getQuota()], m - g->getQuota());
 	}
 
-	gCalculator->free_largeNumberArray(helper.getArrayPointer());
+	if (helper.getArrayPointer() != nullptr) {
+		gCalculator->free_largeNumberArray(helper.getArrayPointer());
+	}
+	gCalculator->free_largeNumber(odd);
+	gCalculator->free_largeNumber(even);
+	gCalculator->free_largeNumberArray(suffix.getArrayPointer());
 }
 
 void epic::index::RawBanzhaf::numberOfSwingPlayer(Game* g, lint::LargeNumber n_sp[], lint::LargeNumber& total_sp) {
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
-		gCalculator->plusEqual(total_sp, n_sp[i]);
-	}
+	gCalculator->plusEqualSum(total_sp, n_sp, g->getNumberOfNonZeroPlayers());
 }
@@ -67,6 +67,12 @@ protected:
 	 * @param total_sp A return parameter containing the calculated sum
 	 */
 	void numberOfSwingPlayer(Game* g, lint::LargeNumber n_sp[], lint::LargeNumber& total_sp);
+
+private:
+	/**
+	 * The smallest weight for which the swings of a player get summed up blockwise from suffix sums of n_wc instead of by a pass over the whole range [quota, weightsum] (see numberOfTimesPlayerIsSwingPlayer()). The blockwise sum needs about 2 * (weightsum - quota) / wi single LargeNumber operations, the pass (weightsum - quota) span elements.
+	 */
+	static constexpr longUInt cMinWindowWeight = 16;
 };
 
 } /* namespace epic::index */
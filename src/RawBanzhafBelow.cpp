@@ -1,7 +1,11 @@
 #include "RawBanzhafBelow.h"
 
 #include "GlobalCalculator.h"
+#include "MeetInTheMiddle.h"
+#include "SmallGame.h"
+#include "SparseCoalitions.h"
 
+#include <algorithm>
 #include <iostream>
 
 epic::index::RawBanzhafBelow::RawBanzhafBelow()
@@ -17,7 +21,7 @@ std::vector<epic::bigFloat> epic::index::RawBanzhafBelow::calculate(Game* g) {
 	std::vector<bigFloat> solution(g->getNumberOfPlayers());
 	{
 		bigInt tmp;
-		bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0(); // additional winning coalitions due to players of weight 0
+		bigInt factor = coalitionsOfPlayersWithWeight0(g); // additional winning coalitions due to players of weight 0
 
 		for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
 			gCalculator->to_bigInt(&tmp, n_sp[i]);
@@ -43,7 +47,18 @@ std::string epic::index::RawBanzhafBelow::getFullName() {
 
 epic::longUInt epic::index::RawBanzhafBelow::getMemoryRequirement(Game* g) {
 	bigInt memory = g->getNumberOfNonZeroPlayers() * gCalculator->getLargeNumberSize();		   // n_sp;
-	memory += (g->getWeightSum() + 1 - g->getQuota()) * gCalculator->getLargeNumberSize() * 2; // n_wc + helper
+	if (SmallGame::isPreferable(g, g->getReducedQuota(), 1)) {
+		memory += SmallGame::getMemoryRequirement(g, 1);
+	} else if (MeetInTheMiddle::isPreferable(g, g->getReducedQuota())) {
+		memory += MeetInTheMiddle::getMemoryRequirement(g, 1);
+	} else if (SparseCoalitions::isPreferable(g, g->getReducedQuota())) {
+		memory += SparseCoalitions::getMemoryRequirement(g, 1);
+	} else {
+		memory += (g->getReducedQuota() * 2 + 2) * gCalculator->getLargeNumberSize(); // n_lc + prefix
+		if (g->getWeights()[g->getNumberOfNonZeroPlayers() - 1] < cMinWindowWeight) {
+			memory += g->getReducedQuota() * gCalculator->getLargeNumberSize(); // helper
+		}
+	}
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
@@ -55,55 +70,143 @@ epic::longUInt epic::index::RawBanzhafBelow::getMemoryRequirement(Game* g) {
 }
 
 void epic::index::RawBanzhafBelow::numberOfTimesPlayerIsSwingPlayer(Game* g, lint::LargeNumber n_sp[]) {
-	// n_lc[x]: number of losing coalitions of weight x
-	auto n_lc = new lint::LargeNumber[g->getQuota()];
-	gCalculator->allocInit_largeNumberArray(n_lc, g->getQuota());
+	// committee-sized games: the dynamic programs would process more weights than there are coalitions
+	if (SmallGame::isPreferable(g, g->getReducedQuota(), 1)) {
+		SmallGame::swingsPerPlayer(g, n_sp);
+		return;
+	}
+
+	// the table would be large compared to the coalitions of half the players
+	if (MeetInTheMiddle::isPreferable(g, g->getReducedQuota())) {
+		MeetInTheMiddle::swingsPerPlayer(g, n_sp);
+		return;
+	}
+
+	// only a few coalition weights are reachable compared to the table size (e.g. very large weights)
+	if (SparseCoalitions::isPreferable(g, g->getReducedQuota())) {
+		SparseCoalitions::swingsPerPlayer(g, n_sp);
+		return;
+	}
+
+	// n_lc[x]: number of losing coalitions of weight x of the reduced game (at least one element, even if the reduced quota is zero)
+	longUInt size = std::max(g->getReducedQuota(), 1UL);
+	auto n_lc = new lint::LargeNumber[size];
+	gCalculator->allocInit_largeNumberArray(n_lc, size);
 	numberOfLosingCoalitionsPerWeight(g, n_lc);
 
 	numberOfTimesPlayerIsSwingPlayer(g, n_lc, n_sp);
 
 	gCalculator->free_largeNumberArray(n_lc);
+	delete[] n_lc;
 }
 
 void epic::index::RawBanzhafBelow::numberOfTimesPlayerIsSwingPlayer(Game* g, lint::LargeNumber n_lc[], lint::LargeNumber n_sp[]) {
-	// helper:: helper array for n_lc
-	auto helper = new lint::LargeNumber[g->getQuota()];
-	gCalculator->allocInit_largeNumberArray(helper, g->getQuota());
+	/*
+	 * prefix[x]: number of losing coalitions of weight < x (x in [0, quota])
+	 *
+	 * The number of losing coalitions of weight x not containing player i is h(x) = n_lc[x] - h(x - wi) = sum_j (-1)^j * n_lc[x - j * wi]. Summing up this alternating sum over the window [quota - wi, quota) only needs the block sums of the blocks [quota - (j + 1) * wi, quota - j * wi), i.e.
+	 *
+	 * sum_{x = quota - wi}^{quota - 1} h(x) = sum_j (-1)^j * (prefix[quota - j * wi] - prefix[quota - (j + 1) * wi])
+	 *
+	 * This needs quota / wi operations on single LargeNumbers instead of a pass over the whole range [0, quota). The even and the odd blocks get summed up separately such that no intermediate value gets negative.
+	 *
+	 * All of this happens in the reduced game of the players v, ..., n - 1 that are not member of every winning coalition (see Game::getNumberOfPlayersInEveryWinningCoalition()), i.e. quota stands for its reduced quota. Adding player i turns a coalition into a winning one only if it already contains the players 0, ..., v - 1, i.e. the swings of player i are the same in both games.
+	 */
+	longUInt v = g->getNumberOfPlayersInEveryWinningCoalition();
+	longUInt quota = g->getReducedQuota();
+
+	auto prefix = new lint::LargeNumber[quota + 1];
+	gCalculator->allocInit_largeNumberArray(prefix, quota + 1);
+	for (longUInt x = 0; x < quota; ++x) {
+		gCalculator->plus(prefix[x + 1], prefix[x], n_lc[x]);
+	}
+
+	lint::LargeNumber even, odd;
+	gCalculator->alloc_largeNumber(even);
+	gCalculator->alloc_largeNumber(odd);
 
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+	// helper:: helper array for n_lc (only needed for the players using the complete pass, i.e. the ones lighter than cMinWindowWeight)
+	lint::LargeNumber* helper = nullptr;
+	if (g->getWeights()[g->getNumberOfNonZeroPlayers() - 1] < cMinWindowWeight) {
+		helper = new lint::LargeNumber[std::max(quota, 1UL)];
+		gCalculator->allocInit_largeNumberArray(helper, std::max(quota, 1UL));
+	}
+
+	for (longUInt i = v; i < g->getNumberOfNonZeroPlayers(); ++i) {
 		// wi: weight of player i (the current player)
 		longUInt wi = g->getWeights()[i];
 
-		longUInt m = std::min(wi, g->getQuota());
-		for (longUInt k = 0; k < m; ++k) {
-			gCalculator->assign(helper[k], n_lc[k]);
+		if (wi >= cMinWindowWeight) {
+			gCalculator->assign_zero(even);
+			gCalculator->assign_zero(odd);
+
+			bool is_even = true;
+			for (longUInt end = quota; end > 0;) {
+				longUInt begin = (end > wi) ? end - wi : 0;
+				lint::LargeNumber& block_sum = is_even ? even : odd;
+				gCalculator->plusEqual(block_sum, prefix[end]);
+				gCalculator->minusEqual(block_sum, prefix[begin]);
+				is_even = !is_even;
+				end = begin;
+			}
+
+			gCalculator->minusEqual(even, odd);
+			gCalculator->plusEqual(n_sp[i], even);
+			continue;
+		}
+
+		longUInt m = std::min(wi, quota);
+		gCalculator->assign(helper, n_lc, m);
+
+		// each block of wi consecutive weights only depends on the block below
+		for (longUInt begin = wi; begin < quota; begin += wi) {
+			gCalculator->minus(&helper[begin], &n_lc[begin], &helper[begin - wi], std::min(wi, quota - begin));
 		}
 
-		for (longUInt k = wi; k < g->getQuota(); ++k) {
-			gCalculator->minus(helper[k], n_lc[k], helper[k - wi]);
+		m = wi > quota ? 0UL : quota - wi;
+		gCalculator->plusEqualSum(n_sp[i], &helper[m], quota - m);
+	}
+
+	// the players 0, ..., v - 1 are swing players in every winning coalition, i.e. in each of the 2^(n - v) coalitions of the reduced game that reach its quota
+	if (v > 0) {
+		gCalculator->assign_one(even);
+		for (longUInt k = v; k < g->getNumberOfNonZeroPlayers(); ++k) {
+			gCalculator->plus(odd, even, even);
+			gCalculator->assign(even, odd);
 		}
+		gCalculator->minusEqual(even, prefix[quota]);
 
-		m = wi > g->getQuota() ? 0UL : g->getQuota() - wi;
-		for (longUInt k = m; k < g->getQuota(); ++k) {
-			gCalculator->plusEqual(n_sp[i], helper[k]);
+		for (longUInt i = 0; i < v; ++i) {
+			gCalculator->plusEqual(n_sp[i], even);
 		}
 	}
 
-	gCalculator->free_largeNumberArray(helper);
+	if (helper != nullptr) {
+		gCalculator->free_largeNumberArray(helper);
+		delete[] helper;
+	}
+	gCalculator->free_largeNumber(odd);
+	gCalculator->free_largeNumber(even);
+	gCalculator->free_largeNumberArray(prefix);
+	delete[] prefix;
 }
 
 void epic::index::RawBanzhafBelow::numberOfSwingPlayer(Game* g, lint::LargeNumber n_sp[], lint::LargeNumber& total_sp) {
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
-		gCalculator->plusEqual(total_sp, n_sp[i]);
-	}
+	gCalculator->plusEqualSum(total_sp, n_sp, g->getNumberOfNonZeroPlayers());
 }
 
 void epic::index::RawBanzhafBelow::numberOfLosingCoalitionsPerWeight(Game* g, lint::LargeNumber n_lc[]) {
+	// the reduced game only contains the players v, ..., n - 1 (see Game::getNumberOfPlayersInEveryWinningCoalition())
+	longUInt quota = g->getReducedQuota();
+	if (quota == 0) {
+		return; // every coalition of the reduced game is winning
+	}
+
 	// initialize the empty coalition (weight = 0) with 1, since it is always losing
 	gCalculator->assign_one(n_lc[0]);
 
 	// For each player...
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+	for (longUInt i = g->getNumberOfPlayersInEveryWinningCoalition(); i < g->getNumberOfNonZeroPlayers(); ++i) {
 		// wi: weight of player i
 		longUInt wi = g->getWeights()[i];
 
@@ -111,9 +214,14 @@ void epic::index::RawBanzhafBelow::numberOfLosingCoalitionsPerWeight(Game* g, li
 		 *	-> this value is the starting position in the array from where on player i is no swing player. Then iterate over all possible combinations of the existing losing coalitions in the array including the new player.
 		 *
 		 * If a losing coalition exists with weight k, at least one coalition with k + weight_of_player_i exists and is losing. (in range of quota - weight_of_player_i - 1 to 0). This works by adding the number of losing coalitions of weight k to the number of possible losing coalitions of weight k + weight of player i.
+		 *
+		 * A block of wi consecutive weights does not overlap its targets, i.e. the blocks get added as single spans starting at the top.
 		 */
-		for (longInt k = g->getQuota() - wi - 1; k >= 0; --k) {
-			gCalculator->plusEqual(n_lc[k + wi], n_lc[k]);
+		longUInt end = (quota > wi) ? quota - wi : 0;
+		while (end > 0) {
+			longUInt begin = (end > wi) ? end - wi : 0;
+			gCalculator->plusEqual(&n_lc[begin + wi], &n_lc[begin], end - begin);
+			end = begin;
 		}
 	}
 }
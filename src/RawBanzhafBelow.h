@@ -49,10 +49,10 @@ protected:
 	 * Calculating how often each player is a swing player.
 	 *
 	 * This function is the same as numberOfTimesPlayerIsSwingPlayer(lint::LargeNumber n_sp[]) but here you can pass the n_lc array. This is useful if the n_lc values are needed outside this function as well and is therefore already calculated.
-	 * The n_lc array must be filled in the range [0, quota - 1].
+	 * The n_lc array must be filled in the range [0, reduced quota - 1] (see Game::getReducedQuota()).
 	 *
 	 * @param g The Game object for the current calculation
-	 * @param n_lc The array containing the number of losing coalitions. n_lc[x]: number of losing coalitions of weight x. The array must be filled in the range [0, quota - 1]!
+	 * @param n_lc The array containing the number of losing coalitions of the reduced game (as it is done by numberOfLosingCoalitionsPerWeight()). n_lc[x]: number of losing coalitions of weight x. The array must be filled in the range [0, reduced quota - 1]!
 	 * @param n_sp A return array. n_sp[x] will be the number how often player x is a swing player. The array must be allocated and zero-initialized at least in the range [0, g.getNumberOfNonZeroPlayers() - 1]!
 	 */
 	void numberOfTimesPlayerIsSwingPlayer(Game* g, lint::LargeNumber n_lc[], lint::LargeNumber n_sp[]);
@@ -70,12 +70,17 @@ protected:
 
 private:
 	/**
-	 * Calculating the number of losing coalitions per coalition-weight.
+	 * Calculating the number of losing coalitions per coalition-weight of the reduced game, i.e. of the players that are not member of every winning coalition (see Game::getNumberOfPlayersInEveryWinningCoalition()).
 	 *
 	 * @param g The Game object for the current calculation
-	 * @param n_lc An array to store the calculation results. This array must be allocated and zero-initialized at least in the range [0, quota - 1]!
+	 * @param n_lc An array to store the calculation results. This array must be allocated and zero-initialized at least in the range [0, reduced quota - 1]!
 	 */
 	void numberOfLosingCoalitionsPerWeight(Game* g, lint::LargeNumber n_lc[]);
+
+	/**
+	 * The smallest weight for which the swings of a player get summed up blockwise from prefix sums of n_lc instead of by a pass over the whole range [0, quota) (see numberOfTimesPlayerIsSwingPlayer()).
+	 */
+	static constexpr longUInt cMinWindowWeight = 16;
 };
 
 } /* namespace epic::index */
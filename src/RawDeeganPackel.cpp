@@ -1,7 +1,10 @@
 #include "RawDeeganPackel.h"
 
 #include "GlobalCalculator.h"
+#include "MinimalWinningCoalitions.h"
+#include "SmallGame.h"
 
+#include <algorithm>
 #include <iostream>
 
 epic::index::RawDeeganPackel::RawDeeganPackel()
@@ -10,26 +13,14 @@ epic::index::RawDeeganPackel::RawDeeganPackel()
 std::vector<epic::bigFloat> epic::index::RawDeeganPackel::calculate(Game* g) {
 	//note: the players are sorted by weight in descending ordering!
 
-	// formula f(n,q) => f[y][x] represents number of coalitions with cardinality y and weight x;
-	Array2d<lint::LargeNumber> f(g->getNumberOfNonZeroPlayers(), g->getQuota() + 1, true);
-	gCalculator->allocInit_largeNumberArray(f.getArrayPointer(), f.getNumberOfElements());
-
-	// initialise the empty coalition with 1, since we know, that the empty coalition is always losing
-	gCalculator->assign_one(f(0, 0));
-
-	/*
-	 *	compute formula f for each player but hold f[n-1][k][x] in array (we start at zero-> n-2) only
-	 */
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers() - 1; ++i) {
-		//wi: weight of player i
-		longUInt wi = g->getWeights()[i];
-		for (longUInt k = i; k <= i; --k) {
-			for (longUInt x = g->getQuota(); x > wi; --x) {
-				gCalculator->plusEqual(f(k + 1, x - 1), f(k, x - wi - 1));
-			}
-		}
+	// committee-sized games: the dynamic programs would process more weights than there are coalitions
+	if (SmallGame::isPreferable(g, g->getQuota(), g->getNumberOfNonZeroPlayers())) {
+		return calculateByEnumeration(g);
 	}
 
+	// formula f(n,q) => f[y][x] represents number of coalitions with cardinality y and weight x (see MinimalWinningCoalitions). It contains the players 0, ..., n-2 at first.
+	MinimalWinningCoalitions<true> mwc_tables(g, g->getNumberOfNonZeroPlayers(), false);
+
 	/*
 	 * formula b(n,q) => b[y][x] represents how many coalitions S there are,
 	 * such that w(S) >= weight x and player i element of S
@@ -37,91 +28,106 @@ std::vector<epic::bigFloat> epic::index::RawDeeganPackel::calculate(Game* g) {
 	*/
 	Array2d<double> b(g->getNumberOfNonZeroPlayers(), g->getQuota() + 1, true);
 
-	bigInt big_tmp;
-
-	// set solution for each player i
-	// solution[i] = DP[i] = unscaled-DP[i] / total number of minimal winning coalitions
-	std::vector<bigFloat> solution(g->getNumberOfPlayers());
-
-	// compute smallest player
-	{
-		longUInt w_last = g->getWeights()[g->getNumberOfNonZeroPlayers() - 1]; // w_last cant be greater or equal than the quota since the quota must be at least 50% and the games must have more than one player!
+	/*
+	 * unscaled-DP = sum_k sum_x f(k, x) * b(k, q - x)
+	 *
+	 * The rows of f get converted to double as a whole (see ItfLargeNumberCalculator::to_double()) instead of one bigInt conversion per cell. Only the range where both factors can be non-zero gets converted: b(k, 0) is never set and f(k, x) is zero for x < k * min_weight (k players of at least the smallest weight contained in f).
+	 */
+	std::vector<double> f_row(g->getQuota());
+	auto unscaledDeeganPackel = [&](MinimalWinningCoalitions<true>& tables, longUInt rows, longUInt min_weight) {
 		double dp_unscaled = 0;
+		for (longUInt k = 0; k < rows; ++k) {
+			longUInt lower = std::min(k * min_weight, g->getQuota());
+			gCalculator->to_double(f_row.data(), tables.getCoalitionsPerWeight(k) + lower, g->getQuota() - lower);
 
-		// initialize b[n-1,,] for computation of DP for player n-1
-		for (longUInt k = 0; k < g->getNumberOfNonZeroPlayers(); ++k) {
-			double tmp = 1 / static_cast<double>(k + 1);
-			for (longUInt x = 1; x < w_last + 1; x++) {
-				b(k, x) = tmp;
-			}
-
-			for (longUInt x = 0; x <= g->getQuota(); x++) {
-				gCalculator->to_bigInt(&big_tmp, f(k, x));
-				dp_unscaled += b(k, g->getQuota() - x) * big_tmp.get_d();
+			for (longUInt x = lower; x < g->getQuota(); ++x) {
+				dp_unscaled += b(k, g->getQuota() - x) * f_row[x - lower];
 			}
 		}
+		return dp_unscaled;
+	};
 
-		solution[g->getNumberOfNonZeroPlayers() - 1] = bigFloat(dp_unscaled);
-	}
+	// set solution for each player i
+	// solution[i] = DP[i] = unscaled-DP[i] / total number of minimal winning coalitions
+	std::vector<bigFloat> solution(g->getNumberOfPlayers());
 
 	// compute for each player from n-1 to zero
-	for (longUInt i = g->getNumberOfNonZeroPlayers() - 2; i < g->getNumberOfNonZeroPlayers(); --i) {
+	// the own backward table b needs the sequential order (see MinimalWinningCoalitions::forEachPlayer())
+	mwc_tables.forEachPlayer([&](MinimalWinningCoalitions<true>& tables, longUInt i) {
 		longUInt wi = g->getWeights()[i];
 
-		// if weight of player <= quota
-		if (wi <= g->getQuota()) {
-			// first iteration: only initialise b[n-1,k,x] ->further down
-			// other iteration: compute b[i,,] from b[i+1,,]
-			for (longUInt k = 0; k <= i; ++k) {
-				for (longUInt x = g->getQuota() + 1; x > wi; --x) {
-					b(k, x - 1) = b(k, x - wi + g->getWeights()[i + 1] - 1) + b(k + 1, x - wi - 1); //(#increment b)
+		if (i == g->getNumberOfNonZeroPlayers() - 1) {
+			// initialize b[n-1,,] for computation of DP for player n-1
+			// w_last can only be greater or equal than the quota if it is the only non-zero player
+			for (longUInt k = 0; k < g->getNumberOfNonZeroPlayers(); ++k) {
+				double tmp = 1 / static_cast<double>(k + 1);
+				for (longUInt x = 1; x <= std::min(wi, g->getQuota()); x++) {
+					b(k, x) = tmp;
 				}
 			}
 		} else {
-			// handle veto player
-			for (longUInt k = 0; k <= i; ++k) {
-				b(k, g->getQuota()) = 1;
-			}
-		}
-
-		// compute f[i,,] from f[i+1,,]
-		for (longUInt k = 0; k <= i; ++k) {
-			for (longUInt x = wi; x < g->getQuota(); ++x) {
-				gCalculator->minus(f(k + 1, x), f(k + 1, x), f(k, x - wi)); //(#decrement f)
+			// if weight of player <= quota
+			if (wi <= g->getQuota()) {
+				// compute b[i,,] from b[i+1,,]
+				for (longUInt k = 0; k <= i; ++k) {
+					for (longUInt x = g->getQuota() + 1; x > wi; --x) {
+						b(k, x - 1) = b(k, x - wi + g->getWeights()[i + 1] - 1) + b(k + 1, x - wi - 1); //(#increment b)
+					}
+				}
+			} else {
+				// handle veto player
+				for (longUInt k = 0; k <= i; ++k) {
+					b(k, g->getQuota()) = 1;
+				}
 			}
-		}
 
-		// specify minimum for formula b
-		longUInt minimum = (g->getQuota() <= wi) ? g->getQuota() : wi + 1;
+			// specify minimum for formula b
+			longUInt minimum = (g->getQuota() <= wi) ? g->getQuota() : wi + 1;
 
-		// reinitialize some values of b[i,,] for player i
-		// if weight of player <= quota
-		for (longUInt k = 0; k <= i; ++k) {
-			double tmp = 1 / static_cast<double>(k + 1);
-			for (longUInt x = g->getWeights()[i + 1] + 1; x < minimum; ++x) {
-				b(k, x) = tmp;
+			// reinitialize some values of b[i,,] for player i
+			for (longUInt k = 0; k <= i; ++k) {
+				double tmp = 1 / static_cast<double>(k + 1);
+				for (longUInt x = g->getWeights()[i + 1] + 1; x < minimum; ++x) {
+					b(k, x) = tmp;
+				}
 			}
 		}
 
 		// compute DP for player i
 		// for player i: f(i-1,k,x)*b(i,k,q-x)
-		double dp_unscaled = 0;
-		for (longUInt k = 0; k <= i; ++k) {
-			for (longUInt x = 0; x <= g->getQuota(); ++x) {
-				gCalculator->to_bigInt(&big_tmp, f(k, x));
-				dp_unscaled += b(k, g->getQuota() - x) * big_tmp.get_d();
-			}
-		}
-
-		solution[i] = bigFloat(dp_unscaled);
-	}
+		// f contains the players 0, ..., i-1
+		longUInt min_weight = (i > 0) ? g->getWeights()[i - 1] : 0;
+		solution[i] = bigFloat(unscaledDeeganPackel(tables, i + 1, min_weight));
+	});
 
 	// handle player of weight zero
 	for (longUInt i = g->getNumberOfNonZeroPlayers(); i < g->getNumberOfPlayers(); ++i) {
 		solution[i] = 0;
 	}
 
-	gCalculator->free_largeNumberArray(f.getArrayPointer());
+
+	return solution;
+}
+
+std::vector<epic::bigFloat> epic::index::RawDeeganPackel::calculateByEnumeration(Game* g) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+
+	// mwc(i, k): number of minimal winning coalitions of cardinality k containing player i
+	Array2d<lint::LargeNumber> mwc(n, n + 1);
+	gCalculator->allocInit_largeNumberArray(mwc.getArrayPointer(), mwc.getNumberOfElements());
+	SmallGame::minimalWinningCoalitionsPerPlayerAndCardinality(g, mwc);
+
+	// solution[i] = unscaled-DP[i] = sum_k mwc(i, k) / k
+	std::vector<bigFloat> solution(g->getNumberOfPlayers());
+	bigInt tmp;
+	for (longUInt i = 0; i < n; ++i) {
+		for (longUInt k = 1; k <= n; ++k) {
+			gCalculator->to_bigInt(&tmp, mwc(i, k));
+			solution[i] += bigFloat(tmp) / k;
+		}
+	}
+
+	gCalculator->free_largeNumberArray(mwc.getArrayPointer());
 
 	return solution;
 }
@@ -131,9 +137,16 @@ std::string epic::index::RawDeeganPackel::getFullName() {
 }
 
 epic::longUInt epic::index::RawDeeganPackel::getMemoryRequirement(Game* g) {
-	bigInt memory = g->getNumberOfNonZeroPlayers() * (g->getQuota() + 1) * gCalculator->getLargeNumberSize(); //f
-	memory += g->getNumberOfNonZeroPlayers() * (g->getQuota() + 1) * c_sizeof_double;						  // b
-	// the memory used by f and b is always larger than the memory needed for the numberOfMinimalWinningCoalitions() function, which is (g->getQuota() + 1 + g->getNumberOfPlayers) * gCalculator->getLargeNumberSize() for wc and sum_minwc.
+	bigInt memory;
+	if (SmallGame::isPreferable(g, g->getQuota(), g->getNumberOfNonZeroPlayers())) {
+		memory = bigInt(g->getNumberOfNonZeroPlayers()) * (g->getNumberOfNonZeroPlayers() + 1) * gCalculator->getLargeNumberSize(); // mwc
+		memory += SmallGame::getMemoryRequirement(g, g->getNumberOfNonZeroPlayers());
+	} else {
+		memory = MinimalWinningCoalitions<true>::getMemoryRequirement(g, g->getNumberOfNonZeroPlayers(), false); //f
+		memory += g->getNumberOfNonZeroPlayers() * (g->getQuota() + 1) * c_sizeof_double;						   // b
+		memory += g->getQuota() * c_sizeof_double;																   // f_row
+		// the memory used by f and b is always larger than the memory needed for MinimalWinningCoalitions::totalNumberOfMinimalWinningCoalitions(), which is g->getQuota() * gCalculator->getLargeNumberSize().
+	}
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
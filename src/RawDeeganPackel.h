@@ -41,6 +41,12 @@ public:
 	longUInt getMemoryRequirement(Game* g) override;
 	bigInt getMaxValueRequirement(ItfUpperBoundApproximation* approx) override;
 	lint::Operation getOperationRequirement() override;
+
+private:
+	/**
+	 * Calculating the unscaled DP of committee-sized games from the minimal winning coalitions per cardinality (see SmallGame)
+	 */
+	std::vector<bigFloat> calculateByEnumeration(Game* g);
 };
 
 } /* namespace epic::index */
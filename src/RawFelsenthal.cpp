@@ -1,6 +1,7 @@
 #include "RawFelsenthal.h"
 
 #include "GlobalCalculator.h"
+#include "MinimalWinningCoalitions.h"
 
 epic::index::RawFelsenthal::RawFelsenthal(Game* g)
 	: ItfPowerIndex() {
@@ -18,95 +19,12 @@ epic::index::RawFelsenthal::RawFelsenthal(Game* g)
 }
 
 void epic::index::RawFelsenthal::minimal_winning_coalitions_of_least_size(Game* g, lint::LargeNumber mwcs[]) {
-	Array2d<lint::LargeNumber> f;
-	f.alloc(mMinsize + 1, g->getQuota() + 1);
-	gCalculator->allocInit_largeNumberArray(f.getArrayPointer(), f.getNumberOfElements());
+	// only the coalitions of at most mMinsize players are of interest
+	MinimalWinningCoalitions<true> mwc_tables(g, mMinsize);
 
-	// initialise the empty coalition with 1, since we know, that the empty coalition is always losing
-	gCalculator->assign_one(f(0, 0));
-
-	// compute formula f for player n-2 and save that in f-(2D)-array
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers() - 1; ++i) {
-		longInt wi = g->getWeights()[i];
-
-		for (longUInt k = (i < mMinsize) ? i + 1 : mMinsize; k > 0; --k) {
-			for (longInt x = g->getQuota() + 1; x > wi; --x) {
-				gCalculator->plusEqual(f(k, x - 1), f(k - 1, x - wi - 1));
-			}
-		}
-	}
-
-	// compute unscaled Felsenthal (<=> number of minimal winning coalitions) for each player!
-	// note: very similar to deegan packel algorithm
-	{
-		Array2d<lint::LargeNumber> b;
-		b.alloc(mMinsize + 1, g->getQuota() + 1);
-		gCalculator->allocInit_largeNumberArray(b.getArrayPointer(), b.getNumberOfElements());
-
-		//tmp_mwcs: temporary largeNumber for interim results
-		lint::LargeNumber tmp_mwcs;
-		gCalculator->allocInit_largeNumber(tmp_mwcs);
-
-		// wi: weight of player i
-		longUInt wi = 0;
-
-		// wi: weight of player i + 1
-		longUInt wi_plus = 0;
-
-		// last player
-		{
-			longUInt last_player = g->getNumberOfNonZeroPlayers() - 1;
-			wi = g->getWeights()[last_player];
-
-			// b is already zero initialized ==> only initialize the 1-entries
-			for (longUInt x = 1; x <= wi; ++x) {
-				gCalculator->assign_one(b(1, x));
-				gCalculator->mul(tmp_mwcs, f(mMinsize - 1, g->getQuota() - x), b(1, x));
-				gCalculator->plusEqual(mwcs[last_player], tmp_mwcs);
-			}
-		}
-
-		// all other players (except the last one)
-		for (longUInt i = g->getNumberOfNonZeroPlayers() - 2; i < g->getNumberOfNonZeroPlayers(); --i) {
-			wi = g->getWeights()[i];
-			wi_plus = g->getWeights()[i + 1];
-
-			for (longUInt k = mMinsize; k > 0; --k) {
-				for (longUInt x = g->getQuota() + 1; x > wi; --x) {
-					gCalculator->plus(b(k, x - 1), b(k, x - wi + wi_plus - 1), b(k - 1, x - wi - 1));
-				}
-			}
-
-			for (longUInt k = 0; k < mMinsize; ++k) {
-				for (longUInt x = wi; x < g->getQuota() + 1; ++x) {
-					gCalculator->minusEqual(f(k + 1, x), f(k, x - wi));
-				}
-			}
-
-			longUInt l = (i + 1 < mMinsize) ? i + 2 : mMinsize;
-			for (longUInt x = wi_plus + 1; x < wi + 1; ++x) {
-				gCalculator->assign_one(b(1, x));
-				for (longUInt k = 2; k <= l; k++) {
-					gCalculator->assign_zero(b(k, x));
-				}
-			}
-
-			for (longUInt x = 0; x <= g->getQuota(); ++x) {
-				for (longUInt k = 0; k < mMinsize; ++k) {
-					gCalculator->mul(tmp_mwcs, f(k, x), b(mMinsize - k, g->getQuota() - x));
-					gCalculator->plusEqual(mwcs[i], tmp_mwcs);
-				}
-			}
-		}
-
-		// delete
-		gCalculator->free_largeNumber(tmp_mwcs);
-		gCalculator->free_largeNumberArray(b.getArrayPointer());
-		b.free();
-	}
-
-	gCalculator->free_largeNumberArray(f.getArrayPointer());
-	f.free();
+	mwc_tables.forEachPlayer([&](MinimalWinningCoalitions<true>& tables, longUInt i) {
+		tables.addMinimalWinningCoalitions(mwcs[i], mMinsize);
+	});
 }
 
 std::vector<epic::bigFloat> epic::index::RawFelsenthal::calculate(Game* g) {
@@ -158,8 +76,8 @@ std::string epic::index::RawFelsenthal::getFullName() {
 }
 
 epic::longUInt epic::index::RawFelsenthal::getMemoryRequirement(Game* g) {
-	bigInt memory = (mMinsize + 1) * (g->getQuota() + 1) * gCalculator->getLargeNumberSize() * 2; // f, b
-	memory += g->getNumberOfNonZeroPlayers() * gCalculator->getLargeNumberSize();				  // mwcs
+	bigInt memory = MinimalWinningCoalitions<true>::getMemoryRequirement(g, mMinsize); // f, b, helper
+	memory += g->getNumberOfNonZeroPlayers() * gCalculator->getLargeNumberSize();	 // mwcs
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
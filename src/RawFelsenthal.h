@@ -51,7 +51,7 @@ public:
 
 protected:
 	/**
-	 * calculating the number of minimal winning coalitions of least size per player
+	 * calculating the number of minimal winning coalitions of least size per player (see MinimalWinningCoalitions)
 	 *
 	 * @param g The Game object for the current calculation
 	 * @param mwcs The return array, mwcs[x]: the number of minimal winning coalitions of least size player x belongs to. The array mus have enough memory for at least numberOfPlayers entries. Each entry must be initialized with zero!
@@ -1,7 +1,10 @@
 #include "RawJohnston.h"
 
-#include "Logging.h"
 #include "GlobalCalculator.h"
+#include "Logging.h"
+#include "Parallel.h"
+
+#include <algorithm>
 
 epic::index::RawJohnston::RawJohnston(Game* g)
 	: PowerIndexWithWinningCoalitions() {
@@ -12,54 +15,62 @@ epic::index::RawJohnston::RawJohnston(Game* g)
 }
 
 std::vector<epic::bigFloat> epic::index::RawJohnston::calculate(Game* g) {
-	Array2d<longUInt> h;
-	h.alloc(g->getNumberOfNonZeroPlayers(), g->getQuota(), true);
+	Array2d<lint::LargeNumber> h;
+	h.alloc(g->getNumberOfNonZeroPlayers(), g->getQuota());
+	gCalculator->allocInit_largeNumberArray(h.getArrayPointer(), h.getNumberOfElements());
 	subsetSumFromSmallestPerWeight(g, h);
 
+	auto max_weight = g->getWeights()[0];
+
+	// smallest[l]: findIndexInRev(g, l), i.e. the row of h considering all players of weight <= l
+	std::vector<longUInt> smallest(max_weight);
+	for (longUInt l = 1; l < max_weight; ++l) {
+		smallest[l] = findIndexInRev(g, l);
+	}
+
 	/*
 	 * Preprocessing step 1: Collect sums later needed for surpluses
 	 */
-	auto max_weight = g->getWeights()[0];
-	auto surplusSums = new longUInt[max_weight]();
+	auto surplusSums = new lint::LargeNumber[max_weight];
+	gCalculator->allocInit_largeNumberArray(surplusSums, max_weight);
 	{ // initialize surplusSums
-		longUInt hSum = 1;
-		surplusSums[0] = hSum;
+		gCalculator->assign_one(surplusSums[0]);
 
 		for (longUInt l = 1; l < max_weight; ++l) {
-			longUInt idx = findIndexInRev(g, l);
+			gCalculator->assign(surplusSums[l], surplusSums[l - 1]);
 
-			if (idx < g->getNumberOfNonZeroPlayers()) {
-				hSum += h(idx, l - 1);
+			if (smallest[l] < g->getNumberOfNonZeroPlayers()) {
+				gCalculator->plusEqual(surplusSums[l], h(smallest[l], l - 1));
 			}
-
-			surplusSums[l] = hSum;
 		}
 	}
 
 	/*
 	 * Preprocessing step 2: Collect sums later needed for deficiencies
+	 *
+	 * deficiencySums(j, deficiency) is the sum of h(smallest[l], l + deficiency) for l = 1, ..., wj - 1 (as long as l + deficiency < quota). Therefore the row of player j equals the row of player j + 1 (the next smaller weight) plus the terms of the weights in between. Each term is a row span of h.
 	 */
-	Array2d<longUInt> deficiencySums;
-	deficiencySums.alloc(g->getNumberOfNonZeroPlayers(), g->getQuota(), true);
-
-	for (longUInt deficiency = 0; deficiency < g->getQuota() - 1; ++deficiency) {
-		for (longUInt j = 0; j < g->getNumberOfNonZeroPlayers(); ++j) {
-			longUInt hSum = 0;
-			auto wj = g->getWeights()[j];
-
-			if (wj > 1.00001) {
-				for (longUInt l = deficiency + 1; l <= wj + deficiency - 1; ++l) {
-					// simplify loop with findIndexInRev() function
-					longUInt idx = findIndexInRev(g, l - deficiency);
-					if (idx < g->getNumberOfNonZeroPlayers() && l < g->getQuota()) {
-						hSum += h(idx, l);
-					}
-				}
+	Array2d<lint::LargeNumber> deficiencySums;
+	deficiencySums.alloc(g->getNumberOfNonZeroPlayers(), g->getQuota());
+	gCalculator->allocInit_largeNumberArray(deficiencySums.getArrayPointer(), deficiencySums.getNumberOfElements());
+
+	for (longUInt j = g->getNumberOfNonZeroPlayers() - 1; j < g->getNumberOfNonZeroPlayers(); --j) { // j >= 0
+		auto wj = g->getWeights()[j];
+		longUInt l = 1;
+
+		if (j < g->getNumberOfNonZeroPlayers() - 1) {
+			gCalculator->assign(&deficiencySums(j, 0), &deficiencySums(j + 1, 0), g->getQuota());
+			l = std::max(g->getWeights()[j + 1], longUInt{1});
+		}
+
+		for (; l < wj && l < g->getQuota(); ++l) {
+			if (smallest[l] < g->getNumberOfNonZeroPlayers()) {
+				gCalculator->plusEqual(&deficiencySums(j, 0), &h(smallest[l], l), g->getQuota() - l);
 			}
-			deficiencySums(j, deficiency) = hSum;
 		}
 	}
 
+	gCalculator->free_largeNumberArray(h.getArrayPointer());
 	h.free();
 
 	/*
@@ -69,67 +80,88 @@ std::vector<epic::bigFloat> epic::index::RawJohnston::calculate(Game* g) {
 	qmwcs.alloc(g->getNumberOfNonZeroPlayers(), g->getNumberOfNonZeroPlayers());
 	gCalculator->allocInit_largeNumberArray(qmwcs.getArrayPointer(), qmwcs.getNumberOfElements());
 
-	// Actually find Johnston indices for all players
-	Array2d<lint::LargeNumber> interm;
-	interm.alloc(g->getQuota(), g->getNumberOfNonZeroPlayers() - 1);
-	gCalculator->allocInit_largeNumberArray(interm.getArrayPointer(), interm.getNumberOfElements());
+	// First case: i the smallest swing player in a coalition. forwardsArray gets extended by one player per step, therefore the players get processed one after another.
+	{
+		Array2d<lint::LargeNumber> forwardsArray;
+		forwardsArray.alloc(g->getQuota(), g->getNumberOfNonZeroPlayers());
+		gCalculator->allocInit_largeNumberArray(forwardsArray.getArrayPointer(), forwardsArray.getNumberOfElements());
 
-	Array2d<lint::LargeNumber> forwardsArray;
-	forwardsArray.alloc(g->getQuota(), g->getNumberOfNonZeroPlayers());
-	gCalculator->allocInit_largeNumberArray(forwardsArray.getArrayPointer(), forwardsArray.getNumberOfElements());
+		lint::LargeNumber tmp, sum1, sum2;
+		gCalculator->allocInit_largeNumber(tmp);
+		gCalculator->allocInit_largeNumber(sum1);
+		gCalculator->allocInit_largeNumber(sum2);
 
-	lint::LargeNumber tmp;
-	gCalculator->allocInit_largeNumber(tmp);
+		for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) { // All weights are greater than zero
+			auto wi = g->getWeights()[i];
 
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) { // All weights are greater than zero
-		auto wi = g->getWeights()[i];
+			longUInt deficiency = g->getQuota() - 1 - wi;
 
-		longUInt deficiency = g->getQuota() - 1 - wi;
+			if (wi > 1.00001) {
+				gCalculator->plusEqual(qmwcs(i, 0), deficiencySums(i, deficiency));
+			}
 
-		if (wi > 1.00001) {
-			gCalculator->plusEqual(qmwcs(i, 0), deficiencySums(i, deficiency));
-		}
+			if (i > 0) {
+				forward_counting_per_weight_cardinality_next_step(g, forwardsArray, g->getWeights(), i - 1, (i == 1));
 
-		if (i > 0) {
-			forward_counting_per_weight_cardinality_next_step(g, forwardsArray, g->getWeights(), i - 1, (i == 1));
+				for (longUInt s = 2; s <= i + 1; ++s) {
+					gCalculator->assign_zero(sum1);
 
-			lint::LargeNumber sum1, sum2;
-			gCalculator->allocInit_largeNumber(sum1);
-			gCalculator->allocInit_largeNumber(sum2);
-
-			for (longUInt s = 2; s <= i + 1; ++s) {
-				gCalculator->assign_zero(sum1);
-
-				for (longUInt currentWeight = 1; currentWeight <= g->getQuota() - wi - 1; ++currentWeight) {
-					deficiency = g->getQuota() - (currentWeight + wi) - 1;
-					gCalculator->mul(tmp, forwardsArray(currentWeight - 1, s - 2), deficiencySums(i, deficiency));
-					gCalculator->plusEqual(sum1, tmp);
-				}
-				gCalculator->plusEqual(qmwcs(i, s - 1), sum1);
-
-				gCalculator->assign_zero(sum2);
-				for (longUInt currentWeight = g->getQuota() - wi; currentWeight <= g->getQuota() - 1; ++currentWeight) {
-					longUInt surplus = currentWeight + wi - g->getQuota();
-					if (wi == 1) {
-						gCalculator->plusEqual(sum2, forwardsArray(currentWeight - 1, s - 2));
-					} else {
-						gCalculator->mul(tmp, forwardsArray(currentWeight - 1, s - 2), surplusSums[wi - surplus - 1]);
-						gCalculator->plusEqual(sum2, tmp);
+					for (longUInt currentWeight = 1; currentWeight <= g->getQuota() - wi - 1; ++currentWeight) {
+						deficiency = g->getQuota() - (currentWeight + wi) - 1;
+						gCalculator->mul(tmp, forwardsArray(currentWeight - 1, s - 2), deficiencySums(i, deficiency));
+						gCalculator->plusEqual(sum1, tmp);
 					}
+					gCalculator->plusEqual(qmwcs(i, s - 1), sum1);
+
+					gCalculator->assign_zero(sum2);
+					for (longUInt currentWeight = g->getQuota() - wi; currentWeight <= g->getQuota() - 1; ++currentWeight) {
+						longUInt surplus = currentWeight + wi - g->getQuota();
+						if (wi == 1) {
+							gCalculator->plusEqual(sum2, forwardsArray(currentWeight - 1, s - 2));
+						} else {
+							gCalculator->mul(tmp, forwardsArray(currentWeight - 1, s - 2), surplusSums[wi - surplus - 1]);
+							gCalculator->plusEqual(sum2, tmp);
+						}
+					}
+					gCalculator->plusEqual(qmwcs(i, s - 1), sum2);
 				}
-				gCalculator->plusEqual(qmwcs(i, s - 1), sum2);
 			}
+		}
 
-			gCalculator->free_largeNumber(sum1);
-			gCalculator->free_largeNumber(sum2);
+		gCalculator->free_largeNumber(tmp);
+		gCalculator->free_largeNumber(sum1);
+		gCalculator->free_largeNumber(sum2);
+		gCalculator->free_largeNumberArray(forwardsArray.getArrayPointer());
+		forwardsArray.free();
+	}
+
+	/*
+	 * Second case: i not the smallest swing player in a coalition. Each player builds its forward counting table interm from scratch and only writes into its own row of qmwcs. Therefore the players get distributed onto multiple threads, each thread using its own interm table.
+	 */
+	{
+		longUInt interm_size = g->getQuota() * (g->getNumberOfNonZeroPlayers() - 1);
+		longUInt number_of_threads = Parallel::getNumberOfThreads(g->getNumberOfNonZeroPlayers() - 1, interm_size * gCalculator->getLargeNumberSize());
+
+		std::vector<Array2d<lint::LargeNumber>> interms(number_of_threads);
+		for (auto& interm : interms) {
+			interm.alloc(g->getQuota(), g->getNumberOfNonZeroPlayers() - 1);
+			gCalculator->allocInit_largeNumberArray(interm.getArrayPointer(), interm.getNumberOfElements());
 		}
 
-		// Second case: i not the smallest swing player in a coalition
-		if (i < g->getNumberOfNonZeroPlayers() - 1) {
+		// the players with the smallest index have the most partners j, i.e. they get started first
+		Parallel::for_each(g->getNumberOfNonZeroPlayers() - 1, number_of_threads, [&](longUInt thread_id, longUInt i) {
+			Array2d<lint::LargeNumber>& interm = interms[thread_id];
+			auto wi = g->getWeights()[i];
+
+			if (i == 0) { // interm gets read for j = 1 before it gets calculated the first time
+				gCalculator->assign_zero(interm.getArrayPointer(), interm.getNumberOfElements());
+			}
+
 			std::vector<longUInt> w(g->getWeights().begin(), g->getWeights().end() - g->getNumberOfPlayersWithWeight0());
 			w.erase(w.begin() + i);
 
-			lint::LargeNumber sum1, sum2;
+			lint::LargeNumber tmp, sum1, sum2;
+			gCalculator->allocInit_largeNumber(tmp);
 			gCalculator->allocInit_largeNumber(sum1);
 			gCalculator->allocInit_largeNumber(sum2);
 
@@ -146,21 +178,18 @@ std::vector<epic::bigFloat> epic::index::RawJohnston::calculate(Game* g) {
 				} else {
 					for (longUInt s = 1; s < g->getNumberOfNonZeroPlayers(); ++s) {
 						gCalculator->assign_zero(sum1);
-						for (longInt currentWeight = 0; currentWeight <= static_cast<longInt>(g->getQuota() - wi - wj - 1); ++currentWeight) {
-							deficiency = g->getQuota() - (currentWeight + wi + wj) - 1;
-							longUInt hSum = 0;
-
-							if (wj > 1.00001) {
-								hSum = deficiencySums(j, deficiency);
-							}
-
-							if (currentWeight == 0 && s == 1) {
-								gCalculator->plusEqual(sum1, hSum);
-							}
-
-							if (s > 1 && currentWeight > 0.001) {
-								gCalculator->mul(tmp, interm(currentWeight - 1, s - 2), hSum);
-								gCalculator->plusEqual(sum1, tmp);
+						if (wj > 1.00001) { // otherwise all deficiency sums are zero
+							for (longInt currentWeight = 0; currentWeight <= static_cast<longInt>(g->getQuota() - wi - wj - 1); ++currentWeight) {
+								longUInt deficiency = g->getQuota() - (currentWeight + wi + wj) - 1;
+
+								if (currentWeight == 0 && s == 1) {
+									gCalculator->plusEqual(sum1, deficiencySums(j, deficiency));
+								}
+
+								if (s > 1 && currentWeight > 0.001) {
+									gCalculator->mul(tmp, interm(currentWeight - 1, s - 2), deficiencySums(j, deficiency));
+									gCalculator->plusEqual(sum1, tmp);
+								}
 							}
 						}
 						gCalculator->plusEqual(qmwcs(i, s), sum1);
@@ -182,20 +211,22 @@ std::vector<epic::bigFloat> epic::index::RawJohnston::calculate(Game* g) {
 				}
 			}
 
+			gCalculator->free_largeNumber(tmp);
 			gCalculator->free_largeNumber(sum1);
 			gCalculator->free_largeNumber(sum2);
+		});
+
+		for (auto& interm : interms) {
+			gCalculator->free_largeNumberArray(interm.getArrayPointer());
+			interm.free();
 		}
 	}
 
+	gCalculator->free_largeNumberArray(surplusSums);
 	delete[] surplusSums;
+	gCalculator->free_largeNumberArray(deficiencySums.getArrayPointer());
 	deficiencySums.free();
 
-	gCalculator->free_largeNumber(tmp);
-	gCalculator->free_largeNumberArray(interm.getArrayPointer());
-	interm.free();
-	gCalculator->free_largeNumberArray(forwardsArray.getArrayPointer());
-	forwardsArray.free();
-
 	mpf_class big_float("0");
 
 	bigInt tmp_int;
@@ -230,7 +261,7 @@ std::vector<epic::bigFloat> epic::index::RawJohnston::calculate(Game* g) {
 	return raw_j;
 }
 
-void epic::index::RawJohnston::subsetSumFromSmallestPerWeight(Game* g, Array2d<longUInt>& h) {
+void epic::index::RawJohnston::subsetSumFromSmallestPerWeight(Game* g, Array2d<lint::LargeNumber>& h) {
 	auto&& w = g->getWeights();
 
 	/*
@@ -257,20 +288,16 @@ void epic::index::RawJohnston::subsetSumFromSmallestPerWeight(Game* g, Array2d<l
 	 * PROCESSING
 	 */
 	{
-		h(0, w[g->getNumberOfNonZeroPlayers() - 1] - 1) = 1;
+		gCalculator->assign_one(h(0, w[g->getNumberOfNonZeroPlayers() - 1] - 1));
 
 		longUInt idx;
 		for (longUInt i = g->getNumberOfNonZeroPlayers() - 2; i < g->getNumberOfNonZeroPlayers(); --i) { //  i <= 0
 			idx = g->getNumberOfNonZeroPlayers() - i - 2;												 // previous dimension
-			for (longUInt x = upper[i]; x > w[i]; --x) {
-				h(idx + 1, x - 1) = h(idx, x - 1) + h(idx, x - w[i] - 1);
-			}
-			h(idx + 1, w[i] - 1) = h(idx, w[i] - 1) + 1;
 
-			// copy the unchanged values from the previous to the current dimension
-			for (longUInt x = w[i] - 2; x < w[i]; --x) { //  x >= 0
-				h(idx + 1, x) = h(idx, x);
-			}
+			// h(idx + 1, x) = h(idx, x) + h(idx, x - w[i]) for x >= w[i], the values below w[i] stay unchanged
+			gCalculator->assign(&h(idx + 1, 0), &h(idx, 0), upper[i]);
+			gCalculator->plusEqual(&h(idx + 1, w[i]), &h(idx, 0), upper[i] - w[i]);
+			gCalculator->increment(h(idx + 1, w[i] - 1));
 		}
 	}
 
@@ -293,7 +320,7 @@ epic::longUInt epic::index::RawJohnston::findIndexInRev(Game* g, longUInt weight
 	return idx;
 }
 
-void epic::index::RawJohnston::forward_counting_per_weight_cardinality_next_step(Game* g, Array2d<lint::LargeNumber>& ret_ptr, std::vector<epic::longUInt> weights, longUInt player_limit, bool first_step) {
+void epic::index::RawJohnston::forward_counting_per_weight_cardinality_next_step(Game* g, Array2d<lint::LargeNumber>& ret_ptr, const std::vector<epic::longUInt>& weights, longUInt player_limit, bool first_step) {
 	/*
 	 * INITIALIZATION
 	 */
@@ -314,9 +341,7 @@ void epic::index::RawJohnston::forward_counting_per_weight_cardinality_next_step
 
 	if (first_step) {
 		for (longUInt i = 0; i < g->getQuota(); ++i) {
-			for (longUInt j = 0; j < player_count; ++j) {
-				gCalculator->assign_zero(ret_ptr(i, j));
-			}
+			gCalculator->assign_zero(&ret_ptr(i, 0), player_count);
 		}
 
 		for (longUInt i = 0; i < player_limit; ++i) {
@@ -326,9 +351,7 @@ void epic::index::RawJohnston::forward_counting_per_weight_cardinality_next_step
 				if (x - wi - 1 == 0) {
 					gCalculator->increment(ret_ptr(x - 2, 0));
 				} else {
-					for (longUInt s = 1; s <= i; ++s) {
-						gCalculator->plusEqual(ret_ptr(x - 2, s), ret_ptr(x - wi - 2, s - 1));
-					}
+					gCalculator->plusEqual(&ret_ptr(x - 2, 1), &ret_ptr(x - wi - 2, 0), i);
 				}
 			}
 		}
@@ -339,9 +362,7 @@ void epic::index::RawJohnston::forward_counting_per_weight_cardinality_next_step
 		if (x - w_limit - 1 == 0) {
 			gCalculator->increment(ret_ptr(x - 2, 0));
 		} else {
-			for (longUInt s = 1; s <= player_limit; ++s) {
-				gCalculator->plusEqual(ret_ptr(x - 2, s), ret_ptr(x - w_limit - 2, s - 1));
-			}
+			gCalculator->plusEqual(&ret_ptr(x - 2, 1), &ret_ptr(x - w_limit - 2, 0), player_limit);
 		}
 	}
 
@@ -353,13 +374,18 @@ std::string epic::index::RawJohnston::getFullName() {
 }
 
 epic::longUInt epic::index::RawJohnston::getMemoryRequirement(Game* g) {
-	// h gets deleted before forwardsArray gets allocated. sizeof(forwardsArray) >= sizeof(h)
-	bigInt memory = g->getWeights()[0] * c_sizeof_longUInt;														   // surplusSums
-	memory += g->getNumberOfNonZeroPlayers() * g->getQuota() * c_sizeof_longUInt;								   // deficiencySums
+	bigInt interm_size = bigInt(g->getQuota()) * (g->getNumberOfNonZeroPlayers() - 1) * gCalculator->getLargeNumberSize();
+	longUInt number_of_threads = interm_size.fits_ulong_p() ? Parallel::getNumberOfThreads(g->getNumberOfNonZeroPlayers() - 1, interm_size.get_ui()) : 1;
+
+	// h gets deleted before forwardsArray gets allocated. sizeof(forwardsArray) >= sizeof(h). forwardsArray gets deleted before interm gets allocated.
+	bigInt memory = g->getWeights()[0] * (c_sizeof_longUInt + gCalculator->getLargeNumberSize());				   // smallest, surplusSums
+	memory += g->getNumberOfNonZeroPlayers() * g->getQuota() * gCalculator->getLargeNumberSize();				   // deficiencySums
 	memory += g->getNumberOfNonZeroPlayers() * g->getNumberOfNonZeroPlayers() * gCalculator->getLargeNumberSize(); // qmwcs
-	memory += g->getQuota() * (g->getNumberOfNonZeroPlayers() - 1) * gCalculator->getLargeNumberSize();			   // interm
-	memory += g->getQuota() * g->getNumberOfNonZeroPlayers() * gCalculator->getLargeNumberSize();				   // forwardsArray
 	memory += g->getNumberOfNonZeroPlayers() * c_sizeof_longUInt;												   // forward_counting_per_weight_cardinality_next_step::upper
+
+	bigInt memory_1 = bigInt(g->getQuota()) * g->getNumberOfNonZeroPlayers() * gCalculator->getLargeNumberSize(); // forwardsArray
+	bigInt memory_2 = interm_size * number_of_threads;															  // interm (one per thread)
+	memory += (memory_1 > memory_2) ? memory_1 : memory_2;
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
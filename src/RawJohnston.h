@@ -49,7 +49,7 @@ private:
      * @param player_limit The upper cardinality limit
      * @param first_step Since this method calculates iteratively, this parameter must be set to true if it is the first iteration.
      */
-	void forward_counting_per_weight_cardinality_next_step(Game* g, Array2d<lint::LargeNumber>& ret_ptr, std::vector<longUInt> weights, longUInt player_limit, bool first_step);
+	void forward_counting_per_weight_cardinality_next_step(Game* g, Array2d<lint::LargeNumber>& ret_ptr, const std::vector<longUInt>& weights, longUInt player_limit, bool first_step);
 
 	/**
 	 * Work out Subset Sum problem by starting with the smallest weight along the lines of CMS book (see book by CMS, p. 230, below)
@@ -57,7 +57,7 @@ private:
 	 * @param g The Game object for the current calculation
 	 * @param h The matrix to return the result. This Array2d must be allocated to have enough space for at least player-count x quota entries. All entries must be zero-initialized!
 	 */
-	void subsetSumFromSmallestPerWeight(Game* g, Array2d<longUInt>& h);
+	void subsetSumFromSmallestPerWeight(Game* g, Array2d<lint::LargeNumber>& h);
 
 	/**
 	 * Finding largest weight w with the property w <= weight
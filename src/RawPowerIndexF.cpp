@@ -1,5 +1,6 @@
 #include "RawPowerIndexF.h"
 
+#include "CardinalityWeightedSum.h"
 #include "Logging.h"
 #include "GlobalCalculator.h"
 
@@ -25,23 +26,15 @@ std::vector<epic::bigFloat> epic::index::RawPowerIndexF::calculate(Game* g) {
 	gCalculator->free_largeNumberArray(n_wc.getArrayPointer());
 	n_wc.free();
 
-	std::vector<bigFloat> solution(g->getNumberOfPlayers());
+	// solution[x] = sum_k pif(x, k) / k
+	std::vector<bigFloat> solution;
 	{
-		bigInt tmp_int;
-		bigFloat tmp_float;
-		bigFloat big_pif;
-
-		for (longUInt i = 0; i < g->getNumberOfPlayers(); ++i) {
-			big_pif = 0;
-
-			for (longUInt k = 1; k <= g->getNumberOfPlayers(); ++k) {
-				gCalculator->to_bigInt(&tmp_int, pif(i, k));
-				tmp_float = tmp_int;
-				big_pif += tmp_float / static_cast<double>(k);
-			}
-
-			solution[i] = big_pif;
+		std::vector<bigFloat> inverse(g->getNumberOfPlayers() + 1);
+		for (longUInt k = 1; k <= g->getNumberOfPlayers(); ++k) {
+			inverse[k] = 1 / bigFloat(k);
 		}
+
+		CardinalityWeightedSum::weightedSum(pif, g->getNumberOfPlayers(), g->getNumberOfPlayers(), inverse, solution);
 	}
 
 	// delete pif
@@ -45,21 +45,12 @@ public:
 
 protected:
 	/**
-	 * Calculating the number of minimal winning coalitions a player belongs to.
+	 * Calculating the number of minimal winning coalitions a player belongs to (see MinimalWinningCoalitions).
 	 *
 	 * @param g The Game object for the current calculation
 	 * @param mwc The return array, mwc[x]: the number of minimal winning coalitions player x belongs to. The array must have enough memory for at least numberOfPlayers entries. Each entry must be initialized with zero!
 	 */
 	void calculateMinimalWinningCoalitionsPerPlayer(Game* g, lint::LargeNumber mwc[]);
-
-private:
-	/**
-	 * Calculating the f vector needed for the minimal winning coalitions calculation.
-	 *
-	 * @param g The Game object for the current calculation
-	 * @param f The return array. The array must have enough memory for at least quota entries. Each entry must be initialized with zero!
-	 */
-	void calculateFVector(Game* g, lint::LargeNumber f[]);
 };
 
 } /* namespace epic::index */
@@ -36,7 +36,7 @@ std::vector<epic::bigFloat> epic::index::RawPublicHelpTheta::calculate(Game* g)
 	auto big_wci = new bigInt[g->getNumberOfPlayers()];
 
 	winningCoalitionsForPlayer(g, big_wci);
-	bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0(); // additional winning coalitions due to players of weight 0
+	bigInt factor = coalitionsOfPlayersWithWeight0(g); // additional winning coalitions due to players of weight 0
 
 	std::vector<bigFloat> solution(g->getNumberOfPlayers());
 	for (longUInt i = 0; i < g->getNumberOfPlayers(); i++) {
@@ -81,19 +81,22 @@ void epic::index::RawPublicHelpTheta::winningCoalitionsForPlayer(Game* g, bigInt
 		}
 
 		longUInt m = std::max(g->getWeightSum() - wi, g->getQuota() - 1);
-		for (longUInt k = g->getWeightSum(); k > m; --k) {
-			gCalculator->assign(helper[k], n_wc[k]);
-		}
-
-		for (longUInt k = g->getWeightSum() - wi; k >= g->getQuota(); --k) {
-			gCalculator->minus(helper[k], n_wc[k], helper[k + wi]);
+		gCalculator->assign(&helper[m + 1], &n_wc[m + 1], g->getWeightSum() - m);
+
+		if (wi == 0) {
+			gCalculator->minus(&helper[g->getQuota()], &n_wc[g->getQuota()], &helper[g->getQuota()], g->getWeightSum() + 1 - g->getQuota());
+		} else {
+			// each block of wi consecutive weights only depends on the block above
+			for (longUInt end = g->getWeightSum() + 1 - wi; end > g->getQuota();) {
+				longUInt begin = (end - g->getQuota() > wi) ? end - wi : g->getQuota();
+				gCalculator->minus(&helper[begin], &n_wc[begin], &helper[begin + wi], end - begin);
+				end = begin;
+			}
 		}
 
 		// this is the only difference to the previously mentioned algorithm.
 		// instead of looping over all coalitions the player would turn into losing ones, we step over all winning coalitions the player is a member of (up to weightsum).
-		for (longUInt k = g->getQuota(); k <= g->getWeightSum(); ++k) {
-			gCalculator->plusEqual(wci[i], helper[k]);
-		}
+		gCalculator->plusEqualSum(wci[i], &helper[g->getQuota()], g->getWeightSum() + 1 - g->getQuota());
 
 		gCalculator->to_bigInt(&big_wci[i], wci[i]);
 	}
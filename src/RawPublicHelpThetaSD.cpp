@@ -15,7 +15,7 @@ std::vector<epic::bigFloat> epic::index::RawPublicHelpThetaSD::calculate(Game* g
 
 	winningCoalitionsForPlayer(g, big_wci);
 
-	bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0(); // additional winning coalitions due to players of weight 0
+	bigInt factor = coalitionsOfPlayersWithWeight0(g); // additional winning coalitions due to players of weight 0
 	std::vector<epic::bigFloat> solution(g->getNumberOfPlayers());
 	for (longUInt i = 0; i < g->getNumberOfPlayers(); i++) {
 		solution[i] = big_wci[i] * factor;
@@ -1,7 +1,11 @@
 #include "RawShapleyShubik.h"
 
 #include "Array.h"
+#include "CardinalityWeightedSum.h"
 #include "GlobalCalculator.h"
+#include "MeetInTheMiddle.h"
+#include "SmallGame.h"
+#include "SparseCoalitions.h"
 
 #include <algorithm>
 
@@ -12,44 +16,26 @@ std::vector<epic::bigFloat> epic::index::RawShapleyShubik::calculate(Game* g) {
 	// ssi(x, y): ShapleyShubik matrix - number of times player x is a swing player in a coalition of cardinality y
 	Array2d<lint::LargeNumber> ssi(g->getNumberOfNonZeroPlayers(), g->getNumberOfNonZeroPlayers() + 1);
 	gCalculator->allocInit_largeNumberArray(ssi.getArrayPointer(), ssi.getNumberOfElements());
-	swingsPerPlayerAndCardinality(g, ssi, true);
-
-	// factorial_s_ns1[x]: x! * (n - x - 1)! ;	n: the number of players (See section 3.2 in Sascha Kurz's paper)
-	auto factorial_s_ns1 = new bigInt[g->getNumberOfNonZeroPlayers()];
-	{
-		// factorial[x]: x!
-		auto factorial = new bigInt[g->getNumberOfNonZeroPlayers() + 1];
-		factorial[0] = 1;
-		factorial[1] = 1;
-
-		for (longUInt i = 2; i <= g->getNumberOfNonZeroPlayers(); ++i) {
-			factorial[i] = factorial[i - 1] * i;
-		}
-		for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
-			factorial_s_ns1[i] = factorial[i] * factorial[g->getNumberOfNonZeroPlayers() - i - 1];
-		}
-
-		delete[] factorial;
+	if (SmallGame::isPreferable(g, g->getWeightSum() + 1 - g->getQuota(), g->getNumberOfNonZeroPlayers())) {
+		SmallGame::swingsPerPlayerAndCardinality(g, ssi);
+	} else if (MeetInTheMiddle::isPreferable(g, g->getWeightSum() + 1 - g->getQuota())) {
+		MeetInTheMiddle::swingsPerPlayerAndCardinality(g, ssi);
+	} else if (SparseCoalitions::isPreferable(g, g->getWeightSum() + 1 - g->getQuota())) {
+		SparseCoalitions::swingsPerPlayerAndCardinality(g, ssi);
+	} else {
+		swingsPerPlayerAndCardinality(g, ssi, true);
 	}
 
+	// raw_ssi[x] = sum_k ssi(x, k) * (k - 1)! * (n - k)! ;	n: the number of players (See section 3.2 in Sascha Kurz's paper)
+	std::vector<bigInt> raw_ssi;
+	CardinalityWeightedSum::factorialWeightedSum(ssi, g->getNumberOfNonZeroPlayers(), g->getNumberOfNonZeroPlayers(), raw_ssi);
+
 	std::vector<bigFloat> solution(g->getNumberOfPlayers());
-	{
-		bigInt dummy;
-		bigInt raw_ssi;
-
-		for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
-			raw_ssi = 0;
-
-			for (longUInt k = 1; k <= g->getNumberOfNonZeroPlayers(); ++k) {
-				gCalculator->to_bigInt(&dummy, ssi(i, k));
-				raw_ssi += dummy * factorial_s_ns1[k - 1];
-			}
-
-			solution[i] = raw_ssi;
-		}
-		for (longUInt i = g->getNumberOfNonZeroPlayers(); i < g->getNumberOfPlayers(); ++i) {
-			solution[i] = 0;
-		}
+	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+		solution[i] = raw_ssi[i];
+	}
+	for (longUInt i = g->getNumberOfNonZeroPlayers(); i < g->getNumberOfPlayers(); ++i) {
+		solution[i] = 0;
 	}
 
 	/*
@@ -58,7 +44,6 @@ std::vector<epic::bigFloat> epic::index::RawShapleyShubik::calculate(Game* g) {
 
 	// delete ssi
 	gCalculator->free_largeNumberArray(ssi.getArrayPointer());
-	delete[] factorial_s_ns1;
 
 	return solution;
 }
@@ -72,11 +57,21 @@ epic::longUInt epic::index::RawShapleyShubik::getMemoryRequirement(Game* g) {
 	memory *= (g->getNumberOfNonZeroPlayers() + 1) * gCalculator->getLargeNumberSize(); // ssi
 	memory /= cMemUnit_factor;
 
-	bigInt memory_1 = SwingsPerPlayerAndCardinality::getMemoryRequirement(g);
+	bigInt memory_1;
+	if (SmallGame::isPreferable(g, g->getWeightSum() + 1 - g->getQuota(), g->getNumberOfNonZeroPlayers())) {
+		memory_1 = SmallGame::getMemoryRequirement(g, g->getNumberOfNonZeroPlayers()) / cMemUnit_factor;
+	} else if (MeetInTheMiddle::isPreferable(g, g->getWeightSum() + 1 - g->getQuota())) {
+		memory_1 = MeetInTheMiddle::getMemoryRequirement(g, g->getNumberOfNonZeroPlayers()) / cMemUnit_factor;
+	} else if (SparseCoalitions::isPreferable(g, g->getWeightSum() + 1 - g->getQuota())) {
+		memory_1 = SparseCoalitions::getMemoryRequirement(g, g->getNumberOfNonZeroPlayers()) / cMemUnit_factor;
+	} else {
+		memory_1 = SwingsPerPlayerAndCardinality::getMemoryRequirement(g);
+	}
 
 	bigInt factorial_n = 0;
 	mpz_fac_ui(factorial_n.get_mpz_t(), g->getNumberOfNonZeroPlayers());
-	bigInt memory_2 = 2 * GMPHelper::size_of_int(factorial_n) * 2; // factorial, factorial_s_ns: sum_{i = 0}^{N} i! < 2 * N!
+	longUInt levels = mpz_sizeinbase(bigInt(g->getNumberOfNonZeroPlayers()).get_mpz_t(), 2);
+	bigInt memory_2 = 2 * GMPHelper::size_of_int(factorial_n) * (levels + 2); // both product trees of CardinalityWeightedSum::factorialWeightedSum() (about n! per level), raw_ssi
 	memory_2 /= cMemUnit_factor;
 
 	memory += (memory_1 > memory_2) ? memory_1 : memory_2;
@@ -1,7 +1,11 @@
 #include "RawShapleyShubikBelow.h"
 
 #include "Array.h"
+#include "CardinalityWeightedSum.h"
 #include "GlobalCalculator.h"
+#include "MeetInTheMiddle.h"
+#include "SmallGame.h"
+#include "SparseCoalitions.h"
 
 #include <algorithm>
 
@@ -12,52 +16,32 @@ std::vector<epic::bigFloat> epic::index::RawShapleyShubikBelow::calculate(Game*
 	// ssi(x, y): ShapleyShubik matrix - number of times player x is a swing player in a coalition of cardinality y
 	Array2d<lint::LargeNumber> ssi(g->getNumberOfNonZeroPlayers(), g->getNumberOfNonZeroPlayers() + 1);
 	gCalculator->allocInit_largeNumberArray(ssi.getArrayPointer(), ssi.getNumberOfElements());
-	swingsPerPlayerAndCardinality(g, ssi);
-
-	// factorial_s_ns1[x]: x! * (n - x - 1)! ;	n: the number of players (See section 3.2 in Sascha Kurz's paper)
-	auto factorial_s_ns1 = new bigInt[g->getNumberOfNonZeroPlayers()];
-	{
-		// factorial[x]: x!
-		auto factorial = new bigInt[g->getNumberOfNonZeroPlayers() + 1];
-		factorial[0] = 1;
-		factorial[1] = 1;
-
-		for (longUInt i = 2; i <= g->getNumberOfNonZeroPlayers(); ++i) {
-			factorial[i] = factorial[i - 1] * i;
-		}
-		for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
-			factorial_s_ns1[i] = factorial[i] * factorial[g->getNumberOfNonZeroPlayers() - i - 1];
-		}
-
-		delete[] factorial;
+	if (SmallGame::isPreferable(g, g->getReducedQuota(), g->getNumberOfNonZeroPlayers())) {
+		SmallGame::swingsPerPlayerAndCardinality(g, ssi);
+	} else if (MeetInTheMiddle::isPreferable(g, g->getReducedQuota())) {
+		MeetInTheMiddle::swingsPerPlayerAndCardinality(g, ssi);
+	} else if (SparseCoalitions::isPreferable(g, g->getReducedQuota())) {
+		SparseCoalitions::swingsPerPlayerAndCardinality(g, ssi);
+	} else {
+		swingsPerPlayerAndCardinality(g, ssi);
 	}
 
-	std::vector<bigFloat> solution(g->getNumberOfPlayers());
-	{
-		bigInt dummy;
-		bigInt raw_ssi;
-
-		for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
-			raw_ssi = 0;
+	// raw_ssi[x] = sum_k ssi(x, k) * (k - 1)! * (n - k)! ;	n: the number of players (See section 3.2 in Sascha Kurz's paper)
+	std::vector<bigInt> raw_ssi;
+	CardinalityWeightedSum::factorialWeightedSum(ssi, g->getNumberOfNonZeroPlayers(), g->getNumberOfNonZeroPlayers(), raw_ssi);
 
-			for (longUInt k = 1; k <= g->getNumberOfNonZeroPlayers(); ++k) {
-				gCalculator->to_bigInt(&dummy, ssi(i, k));
-				raw_ssi += dummy * factorial_s_ns1[k - 1];
-			}
-
-			solution[i] = raw_ssi;
-		}
-
-		for (longUInt i = g->getNumberOfNonZeroPlayers(); i < g->getNumberOfPlayers(); ++i) {
-			solution[i] = 0;
-		}
+	std::vector<bigFloat> solution(g->getNumberOfPlayers());
+	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+		solution[i] = raw_ssi[i];
+	}
+	for (longUInt i = g->getNumberOfNonZeroPlayers(); i < g->getNumberOfPlayers(); ++i) {
+		solution[i] = 0;
 	}
 
 	/*
 	 * DELETE
 	 */
 	gCalculator->free_largeNumberArray(ssi.getArrayPointer());
-	delete[] factorial_s_ns1;
 
 	return solution;
 }
@@ -71,12 +55,25 @@ epic::longUInt epic::index::RawShapleyShubikBelow::getMemoryRequirement(Game* g)
 	memory *= (g->getNumberOfNonZeroPlayers() + 1) * gCalculator->getLargeNumberSize(); // ssi
 	memory /= cMemUnit_factor;
 
-	bigInt memory_1 = bigInt(g->getQuota()) * (g->getNumberOfNonZeroPlayers() + 1) * gCalculator->getLargeNumberSize() * 2; // n_lc, helper
+	bigInt memory_1;
+	if (SmallGame::isPreferable(g, g->getReducedQuota(), g->getNumberOfNonZeroPlayers())) {
+		memory_1 = SmallGame::getMemoryRequirement(g, g->getNumberOfNonZeroPlayers());
+	} else if (MeetInTheMiddle::isPreferable(g, g->getReducedQuota())) {
+		memory_1 = MeetInTheMiddle::getMemoryRequirement(g, g->getNumberOfNonZeroPlayers());
+	} else if (SparseCoalitions::isPreferable(g, g->getReducedQuota())) {
+		memory_1 = SparseCoalitions::getMemoryRequirement(g, g->getNumberOfNonZeroPlayers());
+	} else {
+		memory_1 = bigInt(g->getReducedQuota() * 2 + 4) * (g->getNumberOfNonZeroPlayers() + 1) * gCalculator->getLargeNumberSize(); // n_lc, prefix, block_sums
+		if (g->getWeights()[g->getNumberOfNonZeroPlayers() - 1] < cMinWindowWeight) {
+			memory_1 += bigInt(g->getReducedQuota()) * (g->getNumberOfNonZeroPlayers() + 1) * gCalculator->getLargeNumberSize(); // helper
+		}
+	}
 	memory_1 /= cMemUnit_factor;
 
 	bigInt factorial_n = 0;
 	mpz_fac_ui(factorial_n.get_mpz_t(), g->getNumberOfNonZeroPlayers());
-	bigInt memory_2 = 2 * GMPHelper::size_of_int(factorial_n) * 2; // factorial, factorial_s_ns: sum_{i = 0}^{N} i! < 2 * N!
+	longUInt levels = mpz_sizeinbase(bigInt(g->getNumberOfNonZeroPlayers()).get_mpz_t(), 2);
+	bigInt memory_2 = 2 * GMPHelper::size_of_int(factorial_n) * (levels + 2); // both product trees of CardinalityWeightedSum::factorialWeightedSum() (about n! per level), raw_ssi
 	memory_2 /= cMemUnit_factor;
 
 	memory += (memory_1 > memory_2) ? memory_1 : memory_2;
@@ -98,51 +95,125 @@ epic::lint::Operation epic::index::RawShapleyShubikBelow::getOperationRequiremen
 }
 
 void epic::index::RawShapleyShubikBelow::numberOfLosingCoalitionsPerWeightAndCardinality(Game* g, Array2d<lint::LargeNumber>& n_lc) {
-	gCalculator->assign_one(n_lc(0, 0));
+	// the reduced game only contains the players v, ..., n - 1 (see Game::getNumberOfPlayersInEveryWinningCoalition())
+	longUInt v = g->getNumberOfPlayersInEveryWinningCoalition();
+	longUInt quota = g->getReducedQuota();
+	if (quota == 0) {
+		return; // every coalition of the reduced game is winning
+	}
 
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) { // i: player index
+	// the empty coalition of the reduced game stands for the coalition of the players 0, ..., v - 1 (cardinality v)
+	gCalculator->assign_one(n_lc(0, v));
+
+	for (longUInt i = v; i < g->getNumberOfNonZeroPlayers(); ++i) { // i: player index
 		longUInt wi = g->getWeights()[i];
 
-		for (longInt w = g->getQuota() - wi - 1; w >= 0; --w) {				// w: weight
-			for (longUInt c = 0; c < g->getNumberOfNonZeroPlayers(); ++c) { // c: cardinality
-				gCalculator->plusEqual(n_lc(w + wi, c + 1), n_lc(w, c));
-			}
+		for (longInt w = (longInt)quota - (longInt)wi - 1; w >= 0; --w) { // w: weight
+			gCalculator->plusEqual(&n_lc(w + wi, 1), &n_lc(w, 0), g->getNumberOfNonZeroPlayers());
 		}
 	}
 }
 
 void epic::index::RawShapleyShubikBelow::swingsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& raw_ssi) {
-	Array2d<lint::LargeNumber> n_lc(g->getQuota(), g->getNumberOfNonZeroPlayers() + 1);
+	longUInt n = g->getNumberOfNonZeroPlayers();
+	longUInt v = g->getNumberOfPlayersInEveryWinningCoalition();
+	longUInt quota = g->getReducedQuota();
+
+	// n_lc(w, c): number of losing coalitions of the reduced game of weight w, the cardinality c counting the players 0, ..., v - 1 as well (at least one row, even if the reduced quota is zero)
+	Array2d<lint::LargeNumber> n_lc(std::max(quota, 1UL), n + 1);
 	gCalculator->allocInit_largeNumberArray(n_lc.getArrayPointer(), n_lc.getNumberOfElements());
 	numberOfLosingCoalitionsPerWeightAndCardinality(g, n_lc);
 
-	Array2d<lint::LargeNumber> helper(g->getQuota(), g->getNumberOfNonZeroPlayers() + 1);
-	gCalculator->allocInit_largeNumberArray(helper.getArrayPointer(), helper.getNumberOfElements());
+	/*
+	 * prefix(x, p): number of losing coalitions of weight < x and cardinality p (x in [0, quota])
+	 *
+	 * Unrolling the recursion of the helper matrix below gives helper(w, p) = sum_j (-1)^j * n_lc(w - j * wi, p - j). Summing it up over the window [quota - wi, quota) only needs the block sums of the blocks [quota - (j + 1) * wi, quota - j * wi), i.e.
+	 *
+	 * sum_{w = quota - wi}^{quota - 1} helper(w, p) = sum_j (-1)^j * (prefix(quota - j * wi, p - j) - prefix(quota - (j + 1) * wi, p - j))
+	 *
+	 * For players of weight >= cMinWindowWeight this needs about 2 * quota / wi span operations instead of a pass over the whole range [0, quota) and no helper matrix. The even and the odd blocks get summed up separately such that no intermediate value gets negative.
+	 *
+	 * All of this happens in the reduced game of the players v, ..., n - 1 that are not member of every winning coalition, i.e. quota stands for its reduced quota. Adding player i turns a coalition into a winning one only if it already contains the players 0, ..., v - 1, i.e. the swings of player i are the same in both games (the cardinalities of n_lc already include those players).
+	 */
+	Array2d<lint::LargeNumber> prefix(quota + 1, n + 1);
+	gCalculator->allocInit_largeNumberArray(prefix.getArrayPointer(), prefix.getNumberOfElements());
+	for (longUInt w = 0; w < quota; ++w) {
+		gCalculator->assign(&prefix(w + 1, 0), &prefix(w, 0), n + 1);
+		gCalculator->plusEqual(&prefix(w + 1, 0), &n_lc(w, 0), n + 1);
+	}
+
+	// block_sums(0, y), block_sums(1, y): sums of the even and the odd blocks
+	Array2d<lint::LargeNumber> block_sums(2, n + 1);
+	gCalculator->alloc_largeNumberArray(block_sums.getArrayPointer(), block_sums.getNumberOfElements());
+
+	// helper (only needed for the players lighter than cMinWindowWeight)
+	Array2d<lint::LargeNumber> helper;
+	if (g->getWeights()[n - 1] < cMinWindowWeight) {
+		helper.alloc(std::max(quota, 1UL), n + 1);
+		gCalculator->allocInit_largeNumberArray(helper.getArrayPointer(), helper.getNumberOfElements());
+	}
 
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) { // i: player index
+	for (longUInt i = v; i < n; ++i) { // i: player index
 		longUInt wi = g->getWeights()[i];
 
-		longUInt m = std::min(wi, g->getQuota());
-		for (longUInt w = 0; w < m; ++w) {									// w: weight
-			for (longUInt c = 0; c < g->getNumberOfNonZeroPlayers(); ++c) { // c: cardinality
-				gCalculator->assign(helper(w, c), n_lc(w, c));
+		if (wi >= cMinWindowWeight) {
+			gCalculator->assign_zero(block_sums.getArrayPointer(), block_sums.getNumberOfElements());
+
+			// block j shifts the cardinality by j, i.e. only the cardinalities [1 + j, n] of raw_ssi get affected
+			longUInt j = 0;
+			for (longUInt end = quota; end > 0 && j < n; ++j) {
+				longUInt begin = (end > wi) ? end - wi : 0;
+				lint::LargeNumber* block_sum = block_sums.getArray(j % 2);
+
+				gCalculator->plusEqual(&block_sum[1 + j], &prefix(end, 0), n - j);
+				gCalculator->minus(&block_sum[1 + j], &block_sum[1 + j], &prefix(begin, 0), n - j);
+				end = begin;
 			}
+
+			gCalculator->minus(&block_sums(0, 1), &block_sums(0, 1), &block_sums(1, 1), n);
+			gCalculator->plusEqual(&raw_ssi(i, 1), &block_sums(0, 1), n);
+			continue;
 		}
 
-		for (longUInt w = wi; w < g->getQuota(); ++w) {						 // w: weight
-			for (longUInt c = 1; c <= g->getNumberOfNonZeroPlayers(); ++c) { // c: cardinality
-				gCalculator->minus(helper(w, c), n_lc(w, c), helper(w - wi, c - 1));
-			}
+		// the rows (w: weight) are contiguous, i.e. all of them get copied at once (the cardinality n is never read)
+		longUInt m = std::min(wi, quota);
+		gCalculator->assign(&helper(0, 0), &n_lc(0, 0), m * (n + 1));
+
+		for (longUInt w = wi; w < quota; ++w) { // w: weight
+			gCalculator->minus(&helper(w, 1), &n_lc(w, 1), &helper(w - wi, 0), n);
 		}
 
-		m = wi > g->getQuota() ? 0UL : g->getQuota() - wi;
-		for (longUInt w = m; w < g->getQuota(); ++w) {						// w: weight
-			for (longUInt c = 0; c < g->getNumberOfNonZeroPlayers(); ++c) { // c: cardinality
-				gCalculator->plusEqual(raw_ssi(i, c + 1), helper(w, c));
+		m = wi > quota ? 0UL : quota - wi;
+		for (longUInt w = m; w < quota; ++w) { // w: weight
+			gCalculator->plusEqual(&raw_ssi(i, 1), &helper(w, 0), n);
+		}
+	}
+
+	/*
+	 * The players 0, ..., v - 1 are swing players in every winning coalition. The coalitions of cardinality c containing all of them are the C(n - v, c - v) coalitions of the reduced game of cardinality c - v, prefix(quota, c) of them are losing.
+	 */
+	if (v > 0) {
+		lint::LargeNumber* winning = block_sums.getArray(0);
+		gCalculator->assign_zero(winning, n + 1);
+		gCalculator->assign_one(winning[v]);
+
+		// Pascal's triangle: adding the players v, ..., n - 1 one after another
+		for (longUInt k = 1; k <= n - v; ++k) {
+			for (longUInt c = v + k; c > v; --c) {
+				gCalculator->plusEqual(winning[c], winning[c - 1]);
 			}
 		}
+		gCalculator->minus(&winning[v], &winning[v], &prefix(quota, v), n + 1 - v);
+
+		for (longUInt i = 0; i < v; ++i) {
+			gCalculator->plusEqual(&raw_ssi(i, v), &winning[v], n + 1 - v);
+		}
 	}
 
-	gCalculator->free_largeNumberArray(helper.getArrayPointer());
+	if (helper.getArrayPointer() != nullptr) {
+		gCalculator->free_largeNumberArray(helper.getArrayPointer());
+	}
+	gCalculator->free_largeNumberArray(block_sums.getArrayPointer());
+	gCalculator->free_largeNumberArray(prefix.getArrayPointer());
 	gCalculator->free_largeNumberArray(n_lc.getArrayPointer());
 }
@@ -39,12 +39,12 @@ public:
 
 private:
 	/**
-	 * Calculating the number of losing coalitions per weight and cardinality.
+	 * Calculating the number of losing coalitions per weight and cardinality of the reduced game, i.e. of the players that are not member of every winning coalition (see Game::getNumberOfPlayersInEveryWinningCoalition()).
 	 *
 	 * @param g The Game object for the current calculation
-	 * @param n_lc A matrix where the calculated values will be stored. n_lc(x, y): number of losing coalitions of weight x and cardinality y.
+	 * @param n_lc A matrix where the calculated values will be stored. n_lc(x, y): number of losing coalitions of weight x and cardinality y (the cardinality includes the players that are member of every winning coalition).
 	 *
-	 * @note The n_lc matrix must be allocated and zero initialized at least in the range: [0, quota] x [0, numberOfPlayers + 1]
+	 * @note The n_lc matrix must be allocated and zero initialized at least in the range: [0, reduced quota - 1] x [0, numberOfPlayers + 1]
 	 */
 	void numberOfLosingCoalitionsPerWeightAndCardinality(Game* g, Array2d<lint::LargeNumber>& n_lc);
 
@@ -58,6 +58,11 @@ private:
 	 * @note The values for players of weight zero will remain unchanged, i.e. zero (as initialized).
 	 */
 	void swingsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& raw_ssi);
+
+	/**
+	 * The smallest weight for which the swings of a player get summed up blockwise from prefix sums of n_lc instead of by a pass over the whole range [0, quota) (see swingsPerPlayerAndCardinality()).
+	 */
+	static constexpr longUInt cMinWindowWeight = 4;
 };
 
 } /* namespace epic::index */
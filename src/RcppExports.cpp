@@ -11,8 +11,8 @@ Rcpp::Rostream<false>& Rcpp::Rcerr = Rcpp::Rcpp_cerr_get();
 #endif
 
 // ComputePowerIndexAdapter
-std::vector<std::string> ComputePowerIndexAdapter(Rcpp::String index, Rcpp::Nullable<Rcpp::NumericVector> weights, double quota, Rcpp::String weightsfile, Rcpp::Nullable<Rcpp::List> precoalitions, bool filterNullPlayers, bool verbose, bool weightedMajorityGame, bool inputFloatWeights);
-RcppExport SEXP _EfficientPowerIndices_ComputePowerIndexAdapter(SEXP indexSEXP, SEXP weightsSEXP, SEXP quotaSEXP, SEXP weightsfileSEXP, SEXP precoalitionsSEXP, SEXP filterNullPlayersSEXP, SEXP verboseSEXP, SEXP weightedMajorityGameSEXP, SEXP inputFloatWeightsSEXP) {
+std::vector<std::string> ComputePowerIndexAdapter(Rcpp::String index, Rcpp::Nullable<Rcpp::NumericVector> weights, double quota, Rcpp::String weightsfile, Rcpp::Nullable<Rcpp::List> precoalitions, bool filterNullPlayers, bool verbose, bool weightedMajorityGame, bool inputFloatWeights, double memoryLimit, int threads, bool fastMode, double fastModeTolerance);
+RcppExport SEXP _EfficientPowerIndices_ComputePowerIndexAdapter(SEXP indexSEXP, SEXP weightsSEXP, SEXP quotaSEXP, SEXP weightsfileSEXP, SEXP precoalitionsSEXP, SEXP filterNullPlayersSEXP, SEXP verboseSEXP, SEXP weightedMajorityGameSEXP, SEXP inputFloatWeightsSEXP, SEXP memoryLimitSEXP, SEXP threadsSEXP, SEXP fastModeSEXP, SEXP fastModeToleranceSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -25,13 +25,17 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< bool >::type verbose(verboseSEXP);
     Rcpp::traits::input_parameter< bool >::type weightedMajorityGame(weightedMajorityGameSEXP);
     Rcpp::traits::input_parameter< bool >::type inputFloatWeights(inputFloatWeightsSEXP);
-    rcpp_result_gen = Rcpp::wrap(ComputePowerIndexAdapter(index, weights, quota, weightsfile, precoalitions, filterNullPlayers, verbose, weightedMajorityGame, inputFloatWeights));
+    Rcpp::traits::input_parameter< double >::type memoryLimit(memoryLimitSEXP);
+    Rcpp::traits::input_parameter< int >::type threads(threadsSEXP);
+    Rcpp::traits::input_parameter< bool >::type fastMode(fastModeSEXP);
+    Rcpp::traits::input_parameter< double >::type fastModeTolerance(fastModeToleranceSEXP);
+    rcpp_result_gen = Rcpp::wrap(ComputePowerIndexAdapter(index, weights, quota, weightsfile, precoalitions, filterNullPlayers, verbose, weightedMajorityGame, inputFloatWeights, memoryLimit, threads, fastMode, fastModeTolerance));
     return rcpp_result_gen;
 END_RCPP
 }
 
 static const R_CallMethodDef CallEntries[] = {
-    {"_EfficientPowerIndices_ComputePowerIndexAdapter", (DL_FUNC) &_EfficientPowerIndices_ComputePowerIndexAdapter, 9},
+    {"_EfficientPowerIndices_ComputePowerIndexAdapter", (DL_FUNC) &_EfficientPowerIndices_ComputePowerIndexAdapter, 13},
     {NULL, NULL, 0}
 };
 
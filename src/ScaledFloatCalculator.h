@@ -0,0 +1,349 @@
+#ifndef EPIC_LINT_SCALEDFLOATCALCULATOR_H_
+#define EPIC_LINT_SCALEDFLOATCALCULATOR_H_
+
+#include "FloatCalculator.h"
+#include "Logging.h"
+#include "MemoryTracker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace epic::lint {
+
+/**
+ * A FloatCalculator representing each number by a floating-point value of type Real (double or long double) and a bound on its absolute error
+ *
+ * All values get stored scaled by 2^-mShift. The shift gets chosen once from the upper bound of the calculation (CalculatorConfig::maxValue) such that the upper bound (times 2^cHeadroomBits) does not overflow and 1 (the smallest non-zero value) is still a normal number. Scaling by a power of two is exact, i.e. the values behave like unscaled integers of cDigits significant bits.
+ *
+ * Since all operands are integers, a result below 2^cDigits (unscaled) is exact. Above, the result gets rounded to nearest and its error bound grows by u * |result| (u: the unit roundoff). In addition the error bounds of the operands propagate (the sum of both for additions and subtractions, |a| * e(b) + |b| * e(a) + e(a) * e(b) for multiplications). The error bounds themselves get calculated in floating-point arithmetic, so they get enlarged by the factor cErrorFactor to stay upper bounds. An overflow results in an infinite error bound.
+ *
+ * @tparam Real The floating-point type (double or long double)
+ */
+template<class Real> class ScaledFloatCalculator final : public FloatCalculator {
+	static_assert(std::is_same_v<Real, double> || std::is_same_v<Real, long double>, "ScaledFloatCalculator: Real must be double or long double");
+
+public:
+	/**
+	 * Checking if the range of Real is large enough
+	 *
+	 * @param max_value The maximum value that needs to be representable
+	 * @return true if max_value (times 2^cHeadroomBits) and 1 can both be represented by normal numbers using a common scale
+	 */
+	static bool isApplicable(const bigInt& max_value) {
+		return std::numeric_limits<Real>::is_iec559 && getShift(max_value) <= static_cast<longUInt>(1 - std::numeric_limits<Real>::min_exponent);
+	}
+
+	/**
+	 * Constructing a ScaledFloatCalculator object
+	 *
+	 * @param max_value The maximum value that needs to be representable (see isApplicable())
+	 */
+	explicit ScaledFloatCalculator(const bigInt& max_value)
+		: mShift(static_cast<int>(getShift(max_value))), mOne(std::ldexp(Real(1), -mShift)), mExactLimit(std::ldexp(Real(1), cDigits - mShift)) {
+		log::out << log::info << "Using " << (std::is_same_v<Real, double> ? "double" : "long double") << " floating-point numbers (" << cDigits << " bits, scaled by 2^-" << mShift << ")" << log::endl;
+	}
+
+	longUInt getLargeNumberSize() override {
+		return sizeof(LargeNumber) + 2 * sizeof(Real);
+	}
+
+	void increment(LargeNumber& dest) override {
+		Real* d = values(dest);
+		d[0] += mOne;
+		d[1] = roundingError(d[0], d[1]);
+	}
+
+	void plus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override {
+		add(values(dest), values(op1), values(op2));
+	}
+
+	void plusEqual(LargeNumber& dest, const longUInt& op) override {
+		Real o[2];
+		fromUInt(o, op);
+		o[0] = std::ldexp(o[0], -mShift);
+		o[1] = std::ldexp(o[1], -mShift);
+		add(values(dest), values(dest), o);
+	}
+
+	void plusEqual(LargeNumber& dest, const LargeNumber& op) override {
+		add(values(dest), values(dest), values(op));
+	}
+
+	void plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) override {
+		for (longUInt i = 0; i < n; ++i) {
+			add(values(dest[i]), values(dest[i]), values(op[i]));
+		}
+	}
+
+	void plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) override {
+		Real* d = values(dest);
+		for (longUInt i = 0; i < n; ++i) {
+			add(d, d, values(op[i * stride]));
+		}
+	}
+
+	void plusEqualConvolution(LargeNumber& dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) override {
+		Real* d = values(dest);
+		Real product[2];
+		for (longUInt i = 0; i < n; ++i) {
+			multiply(product, values(op1[i]), values(op2[n - 1 - i]));
+			add(d, d, product);
+		}
+	}
+
+	void minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override {
+		sub(values(dest), values(op1), values(op2));
+	}
+
+	void minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) override {
+		for (longUInt i = 0; i < n; ++i) {
+			sub(values(dest[i]), values(op1[i]), values(op2[i]));
+		}
+	}
+
+	void minusEqual(LargeNumber& dest, const LargeNumber& op) override {
+		sub(values(dest), values(dest), values(op));
+	}
+
+	void mul(LargeNumber& dest, const LargeNumber& op1, const longUInt& op2) override {
+		Real o[2];
+		fromUInt(o, op2);
+		mulUnscaled(values(dest), values(op1), o);
+	}
+
+	void mul(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override {
+		multiply(values(dest), values(op1), values(op2));
+	}
+
+	void mulEqual(LargeNumber& dest, const LargeNumber& op) override {
+		multiply(values(dest), values(dest), values(op));
+	}
+
+	void assign(LargeNumber& dest, const LargeNumber& value) override {
+		std::copy(values(value), values(value) + 2, values(dest));
+	}
+
+	void assign(LargeNumber& dest, const longUInt& value) override {
+		Real* d = values(dest);
+		fromUInt(d, value);
+		d[0] = std::ldexp(d[0], -mShift);
+		d[1] = std::ldexp(d[1], -mShift);
+	}
+
+	void assign_zero(LargeNumber& dest) override {
+		std::fill(values(dest), values(dest) + 2, Real(0));
+	}
+
+	void assign(LargeNumber* dest, const LargeNumber* src, longUInt n) override {
+		for (longUInt i = 0; i < n; ++i) {
+			std::copy(values(src[i]), values(src[i]) + 2, values(dest[i]));
+		}
+	}
+
+	void assign_zero(LargeNumber* dest, longUInt n) override {
+		for (longUInt i = 0; i < n; ++i) {
+			std::fill(values(dest[i]), values(dest[i]) + 2, Real(0));
+		}
+	}
+
+	void assign_one(LargeNumber& dest) override {
+		Real* d = values(dest);
+		d[0] = mOne;
+		d[1] = 0;
+	}
+
+	void to_bigInt(bigInt* dest, const LargeNumber& value) override {
+		const Real* v = values(value);
+		updateRelativeErrorBound(relativeError(v));
+
+		*dest = 0;
+		if (v[0] == 0 || !std::isfinite(v[0])) {
+			return;
+		}
+
+		// |v| = mantissa * 2^(exponent - cDigits), the mantissa is an integer of cDigits bits
+		int exponent;
+		Real mantissa = std::ldexp(std::frexp(std::fabs(v[0]), &exponent), cDigits);
+		exponent += mShift - cDigits;
+
+		// converting the mantissa in chunks of 32 bits (unsigned long may only have 32 bits)
+		for (int k = (cDigits - 1) / 32; k >= 0; --k) {
+			Real chunk = std::floor(std::ldexp(mantissa, -32 * k));
+			mantissa -= std::ldexp(chunk, 32 * k);
+			*dest <<= 32;
+			*dest += static_cast<unsigned long>(chunk);
+		}
+
+		if (exponent >= 0) {
+			*dest <<= exponent;
+		} else {
+			*dest >>= -exponent;
+		}
+		if (v[0] < 0) {
+			*dest = -*dest;
+		}
+	}
+
+	void to_double(double* dest, const LargeNumber* value, longUInt n) override {
+		for (longUInt i = 0; i < n; ++i) {
+			const Real* v = values(value[i]);
+			updateRelativeErrorBound(relativeError(v));
+			dest[i] = static_cast<double>(std::ldexp(v[0], mShift));
+		}
+	}
+
+	void alloc_largeNumberArray(LargeNumber* array, longUInt number_of_elements) override {
+		auto mem_pool = MemoryTracker::new_array<Real>(number_of_elements * 2);
+
+		for (longUInt i = 0; i < number_of_elements; ++i) {
+			pointer(array[i]) = mem_pool + (i * 2);
+		}
+	}
+
+	void allocInit_largeNumberArray(LargeNumber* array, longUInt number_of_elements) override {
+		auto mem_pool = MemoryTracker::new_array<Real>(number_of_elements * 2, true);
+
+		for (longUInt i = 0; i < number_of_elements; ++i) {
+			pointer(array[i]) = mem_pool + (i * 2);
+		}
+	}
+
+	void free_largeNumberArray(LargeNumber* array) override {
+		MemoryTracker::delete_array(pointer(array[0]));
+	}
+
+	void alloc_largeNumber(LargeNumber& big_number) override {
+		pointer(big_number) = MemoryTracker::new_array<Real>(2);
+	}
+
+	void allocInit_largeNumber(LargeNumber& big_number) override {
+		pointer(big_number) = MemoryTracker::new_array<Real>(2, true);
+	}
+
+	void free_largeNumber(LargeNumber& big_number) override {
+		MemoryTracker::delete_array(pointer(big_number));
+	}
+
+private:
+	/**
+	 * The number of significant bits of Real
+	 */
+	static constexpr int cDigits = std::numeric_limits<Real>::digits;
+
+	/**
+	 * The unit roundoff u: the relative error of a result rounded to nearest is at most u
+	 */
+	static constexpr Real cUnitRoundoff = std::numeric_limits<Real>::epsilon() / 2;
+
+	/**
+	 * The factor each error bound gets multiplied by to compensate the rounding errors of its own calculation (at most three operations each rounding by a factor >= 1 - u)
+	 */
+	static constexpr Real cErrorFactor = 1 + 8 * cUnitRoundoff;
+
+	/**
+	 * The number of bits the values may exceed the upper bound before overflowing (an intermediate value may exceed the upper bound of the results, e.g. a suffix sum of all winning coalitions)
+	 */
+	static constexpr longUInt cHeadroomBits = 64;
+
+	/**
+	 * The exponent of the scale 2^-mShift of all values
+	 */
+	const int mShift;
+
+	/**
+	 * The representation of 1 (2^-mShift)
+	 */
+	const Real mOne;
+
+	/**
+	 * The representation of 2^cDigits: all (integer) results below are exact
+	 */
+	const Real mExactLimit;
+
+	static longUInt getShift(const bigInt& max_value) {
+		longUInt bits = mpz_sizeinbase(max_value.get_mpz_t(), 2) + cHeadroomBits;
+		longUInt max_exponent = std::numeric_limits<Real>::max_exponent - 1;
+		return (bits > max_exponent) ? bits - max_exponent : 0;
+	}
+
+	// the value and its error bound
+	static inline Real* values(const LargeNumber& number) {
+		if constexpr (std::is_same_v<Real, double>) {
+			return number.reals;
+		} else {
+			return number.long_reals;
+		}
+	}
+
+	static inline Real*& pointer(LargeNumber& number) {
+		if constexpr (std::is_same_v<Real, double>) {
+			return number.reals;
+		} else {
+			return number.long_reals;
+		}
+	}
+
+	// the error bound of result, calculated from operands with the (propagated) error bound error
+	inline Real roundingError(Real result, Real error) const {
+		if (std::fabs(result) >= mExactLimit) {
+			error += cUnitRoundoff * std::fabs(result);
+		}
+		return error * cErrorFactor;
+	}
+
+	// dest = op (unscaled, op is not exact above 2^cDigits)
+	static inline void fromUInt(Real* dest, longUInt op) {
+		dest[0] = static_cast<Real>(op);
+		dest[1] = (dest[0] >= std::ldexp(Real(1), cDigits)) ? cUnitRoundoff * dest[0] * cErrorFactor : 0;
+	}
+
+	inline void add(Real* dest, const Real* op1, const Real* op2) const {
+		Real error = op1[1] + op2[1];
+		dest[0] = op1[0] + op2[0];
+		dest[1] = roundingError(dest[0], error);
+	}
+
+	inline void sub(Real* dest, const Real* op1, const Real* op2) const {
+		Real error = op1[1] + op2[1];
+		dest[0] = op1[0] - op2[0];
+		dest[1] = roundingError(dest[0], error);
+	}
+
+	// dest = op1 * op2, op1 scaled, op2 unscaled
+	inline void mulUnscaled(Real* dest, const Real* op1, const Real* op2) const {
+		Real error = std::fabs(op1[0]) * op2[1] + std::fabs(op2[0]) * op1[1] + op1[1] * op2[1];
+		dest[0] = op1[0] * op2[0];
+		dest[1] = roundingError(dest[0], error);
+	}
+
+	// dest = op1 * op2, both scaled: the smaller factor gets unscaled such that the product neither over- nor underflows
+	inline void multiply(Real* dest, const Real* op1, const Real* op2) const {
+		bool swap = std::fabs(op1[0]) < std::fabs(op2[0]);
+		const Real* large = swap ? op2 : op1;
+		const Real* small = swap ? op1 : op2;
+		Real unscaled[2] = {std::ldexp(small[0], mShift), std::ldexp(small[1], mShift)};
+		mulUnscaled(dest, large, unscaled);
+	}
+
+	// the bound on the relative error of a value, i.e. e / (|v| - e) as |exact value| >= |v| - e
+	static double relativeError(const Real* value) {
+		if (!std::isfinite(value[0]) || !std::isfinite(value[1])) {
+			return std::numeric_limits<double>::infinity();
+		}
+		if (value[1] == 0) {
+			return 0;
+		}
+
+		Real lower = (std::fabs(value[0]) - value[1]) * (1 - 4 * cUnitRoundoff);
+		if (lower <= 0) {
+			return std::numeric_limits<double>::infinity();
+		}
+		return static_cast<double>(value[1] / lower * cErrorFactor) * (1 + 4 * std::numeric_limits<double>::epsilon());
+	}
+};
+
+} /* namespace epic::lint */
+
+#endif /* EPIC_LINT_SCALEDFLOATCALCULATOR_H_ */
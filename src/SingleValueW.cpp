@@ -1,29 +1,35 @@
 #include "SingleValueW.h"
 
 #include "GlobalCalculator.h"
+#include "SmallGame.h"
 
 epic::index::SingleValueW::SingleValueW()
 	: RawBanzhaf() {}
 
 std::vector<epic::bigFloat> epic::index::SingleValueW::calculate(Game* g) {
-	// n_wc[x]: number of winning coalitions of weight x.
-	ArrayOffset<lint::LargeNumber> n_wc(g->getWeightSum() + 1, g->getQuota());
-	gCalculator->allocInit_largeNumberArray(n_wc.getArrayPointer(), n_wc.getNumberOfElements());
-	numberOfWinningCoalitionsPerWeight(g, n_wc);
-
 	// total_wc: the number of winning coalitions
 	lint::LargeNumber total_wc;
 	gCalculator->allocInit_largeNumber(total_wc);
-	numberOfWinningCoalitions(g, n_wc, total_wc);
 
-	gCalculator->free_largeNumberArray(n_wc.getArrayPointer());
+	// committee-sized games: the dynamic programs would process more weights than there are coalitions
+	if (SmallGame::isPreferable(g, g->getWeightSum() + 1 - g->getQuota(), 1)) {
+		SmallGame::numberOfWinningCoalitions(g, total_wc);
+	} else {
+		// n_wc[x]: number of winning coalitions of weight x.
+		ArrayOffset<lint::LargeNumber> n_wc(g->getWeightSum() + 1, g->getQuota());
+		gCalculator->allocInit_largeNumberArray(n_wc.getArrayPointer(), n_wc.getNumberOfElements());
+		numberOfWinningCoalitionsPerWeight(g, n_wc);
+		numberOfWinningCoalitions(g, n_wc, total_wc);
+
+		gCalculator->free_largeNumberArray(n_wc.getArrayPointer());
+	}
 
 	std::vector<bigFloat> solution(1);
 	{
 		bigInt big_total_wc;
 		gCalculator->to_bigInt(&big_total_wc, total_wc);
 
-		bigInt factor = bigInt(1) << g->getNumberOfPlayersWithWeight0();
+		bigInt factor = coalitionsOfPlayersWithWeight0(g);
 		solution[0] = big_total_wc * factor;
 	}
 
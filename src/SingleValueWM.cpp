@@ -1,11 +1,18 @@
 #include "SingleValueWM.h"
 
+#include "MinimalWinningCoalitions.h"
+#include "SmallGame.h"
+
 epic::index::SingleValueWM::SingleValueWM()
 	: DeeganPackel() {}
 
 std::vector<epic::bigFloat> epic::index::SingleValueWM::calculate(Game* g) {
 	bigInt total_mwc;
-	numberOfMinimalWinningCoalitions(g, &total_mwc);
+	if (SmallGame::isPreferable(g, g->getQuota(), 1)) {
+		SmallGame::totalNumberOfMinimalWinningCoalitions(g, &total_mwc);
+	} else {
+		MinimalWinningCoalitions<false>::totalNumberOfMinimalWinningCoalitions(g, &total_mwc);
+	}
 
 	return {static_cast<bigFloat>(total_mwc)};
 }
@@ -15,9 +15,7 @@ std::vector<epic::bigFloat> epic::index::SingleValueWS::calculate(Game* g) {
 	lint::LargeNumber sum_mwcs;
 	gCalculator->allocInit_largeNumber(sum_mwcs);
 
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
-		gCalculator->plusEqual(sum_mwcs, mwcs[i]);
-	}
+	gCalculator->plusEqualSum(sum_mwcs, mwcs, g->getNumberOfNonZeroPlayers());
 
 	gCalculator->free_largeNumberArray(mwcs);
 	delete[] mwcs;
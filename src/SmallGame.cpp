@@ -0,0 +1,198 @@
+#include "SmallGame.h"
+
+#include "GlobalCalculator.h"
+#include "Logging.h"
+
+#include <algorithm>
+#include <bitset>
+
+bool epic::index::SmallGame::isPreferable(Game* g, bigInt table_size, longUInt rows) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+	if (n == 0 || n > cMaxPlayers) {
+		return false;
+	}
+
+	// the dynamic programs process each weight of their tables once per player
+	return bigInt(longUInt(1) << n) * cMinDenseFactor <= table_size * n * rows;
+}
+
+bool epic::index::SmallGame::isApplicable(const std::string& short_name, Game* g) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+	longUInt size_above = g->getWeightSum() + 1 - g->getQuota();
+
+	// the tables the index classes would use otherwise
+	if (short_name == "BZ" || short_name == "ABZ" || short_name == "RBZ" || short_name == "W") {
+		return isPreferable(g, size_above, 1);
+	} else if (short_name == "BZB" || short_name == "RBZB") {
+		return isPreferable(g, g->getReducedQuota(), 1);
+	} else if (short_name == "SH" || short_name == "RSH") {
+		return isPreferable(g, size_above, n);
+	} else if (short_name == "SHB" || short_name == "RSHB") {
+		return isPreferable(g, g->getReducedQuota(), n);
+	} else if (short_name == "PG" || short_name == "RPG" || short_name == "WM") {
+		return isPreferable(g, g->getQuota(), 1);
+	} else if (short_name == "DP" || short_name == "RDP") {
+		return isPreferable(g, g->getQuota(), n);
+	}
+
+	return false;
+}
+
+epic::bigInt epic::index::SmallGame::getMaxValueRequirement(Game* g) {
+	return bigInt(g->getNumberOfNonZeroPlayers()) << g->getNumberOfNonZeroPlayers();
+}
+
+void epic::index::SmallGame::swingsPerPlayer(Game* g, lint::LargeNumber n_sp[]) {
+	std::vector<longUInt> swings;
+	enumerate(g, false, 1, swings);
+
+	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+		gCalculator->assign(n_sp[i], swings[i]);
+	}
+}
+
+void epic::index::SmallGame::swingsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& raw_ssi) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+
+	std::vector<longUInt> swings;
+	enumerate(g, false, n + 1, swings);
+
+	for (longUInt i = 0; i < n; ++i) {
+		for (longUInt c = 0; c <= n; ++c) {
+			gCalculator->assign(raw_ssi(i, c), swings[i * (n + 1) + c]);
+		}
+	}
+}
+
+void epic::index::SmallGame::minimalWinningCoalitionsPerPlayer(Game* g, lint::LargeNumber mwc[]) {
+	std::vector<longUInt> memberships;
+	enumerate(g, true, 1, memberships);
+
+	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+		gCalculator->assign(mwc[i], memberships[i]);
+	}
+}
+
+void epic::index::SmallGame::minimalWinningCoalitionsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& mwc) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+
+	std::vector<longUInt> memberships;
+	enumerate(g, true, n + 1, memberships);
+
+	for (longUInt i = 0; i < n; ++i) {
+		for (longUInt c = 0; c <= n; ++c) {
+			gCalculator->assign(mwc(i, c), memberships[i * (n + 1) + c]);
+		}
+	}
+}
+
+void epic::index::SmallGame::numberOfWinningCoalitions(Game* g, lint::LargeNumber& total_wc) {
+	std::vector<longUInt> unused;
+	gCalculator->assign(total_wc, enumerate(g, false, 0, unused));
+}
+
+void epic::index::SmallGame::totalNumberOfMinimalWinningCoalitions(Game* g, bigInt* total_mwc) {
+	std::vector<longUInt> unused;
+	*total_mwc = bigInt(enumerate(g, true, 0, unused));
+}
+
+epic::bigInt epic::index::SmallGame::getMemoryRequirement(Game* g, longUInt rows) {
+	return bigInt(g->getNumberOfNonZeroPlayers()) * ((rows > 1) ? rows + 1 : rows) * c_sizeof_longUInt; // counts (the cardinalities 0, ..., n)
+}
+
+epic::longUInt epic::index::SmallGame::enumerate(Game* g, bool minimal, longUInt rows, std::vector<longUInt>& counts) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+	longUInt quota = g->getQuota();
+	const std::vector<longUInt>& weights = g->getWeights();
+
+	log::out << log::info << "Enumerating all coalitions of the " << n << " non-zero players" << log::endl;
+
+	counts.assign(n * rows, 0);
+	longUInt total = 0;
+
+	auto addWinningCoalition = [&](longUInt members, longUInt weight) {
+		if (!minimal && rows == 0) {
+			++total;
+			return;
+		}
+
+		longUInt surplus = weight - quota;
+		longUInt c = (rows > 1) ? std::bitset<32>(members).count() : 0;
+
+		// the swing players: the members of weight greater than the surplus (a prefix of the members, the players are sorted by decreasing weight)
+		longUInt end = 0;
+		while (end < n && weights[end] > surplus) {
+			++end;
+		}
+
+		if (minimal) {
+			// the lightest member must be a swing player
+			longUInt last = n - 1;
+			while (!((members >> last) & 1)) {
+				--last;
+			}
+			if (last >= end) {
+				return;
+			}
+			end = last + 1;
+		}
+
+		++total;
+		for (longUInt i = 0; i < end && rows > 0; ++i) {
+			if ((members >> i) & 1) {
+				++counts[i * rows + c];
+			}
+		}
+	};
+
+	// lanes: the coalitions of the players [n_high, n)
+	longUInt n_lanes = std::min(n, cLanePlayers);
+	longUInt n_high = n - n_lanes;
+	longUInt lanes = longUInt(1) << n_lanes;
+
+	longUInt lane_weight[longUInt(1) << cLanePlayers];
+	for (longUInt k = 0; k < lanes; ++k) {
+		lane_weight[k] = 0;
+		for (longUInt j = 0; j < n_lanes; ++j) {
+			if ((k >> j) & 1) {
+				lane_weight[k] += weights[n_high + j];
+			}
+		}
+	}
+
+	// Gray code enumeration of the coalitions of the players [0, n_high)
+	longUInt high_members = 0;
+	longUInt high_weight = 0;
+	longUInt lane_total[longUInt(1) << cLanePlayers];
+	for (longUInt step = 0; step < (longUInt(1) << n_high); ++step) {
+		if (step > 0) {
+			// the player to add or remove: the lowest set bit of step
+			longUInt player = 0;
+			while (!((step >> player) & 1)) {
+				++player;
+			}
+			high_members ^= longUInt(1) << player;
+			if ((high_members >> player) & 1) {
+				high_weight += weights[player];
+			} else {
+				high_weight -= weights[player];
+			}
+		}
+
+		// not even adding all lane players reaches the quota
+		if (high_weight + lane_weight[lanes - 1] < quota) {
+			continue;
+		}
+
+		for (longUInt k = 0; k < lanes; ++k) {
+			lane_total[k] = high_weight + lane_weight[k];
+		}
+		for (longUInt k = 0; k < lanes; ++k) {
+			if (lane_total[k] >= quota) {
+				addWinningCoalition(high_members | (k << n_high), lane_total[k]);
+			}
+		}
+	}
+
+	return total;
+}
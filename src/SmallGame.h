@@ -0,0 +1,135 @@
+#ifndef EPIC_INDEX_SMALLGAME_H_
+#define EPIC_INDEX_SMALLGAME_H_
+
+#include "Array.h"
+#include "Game.h"
+#include "LargeNumber.h"
+#include "types.h"
+
+#include <string>
+#include <vector>
+
+namespace epic::index {
+
+/**
+ * Counting the swings and minimal winning coalitions of small games (a few non-zero players) by enumerating all coalitions.
+ *
+ * For committee-sized games the dynamic programs themselves are cheap, the setup dominates: approximating the upper bound, choosing a calculator (including the prime numbers of ChineseRemainder), checking the hardware and allocating the tables. Enumerating the coalitions needs none of those. All coalitions get enumerated in a single pass and the counts get accumulated using plain longUInt counters (a game of at most cMaxPlayers players has less than 2^cMaxPlayers coalitions). They get converted into LargeNumbers at the end only, the index classes calculate their solutions from them as from the tables of the dynamic programs.
+ *
+ * The lightest cLanePlayers players form the lanes: the weights of their 2^cLanePlayers coalitions get precalculated. The remaining players get enumerated in Gray code order, i.e. each step adds or removes a single player and updates the weight incrementally. For each of those coalitions the weights of all lanes get calculated and compared to the quota as a whole (vectorizable), only the winning lanes get inspected further.
+ *
+ * Since the players are sorted by decreasing weight, the swing players of a winning coalition S are its members of weight greater than w(S) - quota, i.e. a prefix of its members. S is a minimal winning coalition iff its lightest member is a swing player.
+ */
+class SmallGame {
+public:
+	SmallGame() = delete;
+
+	/**
+	 * Checking whether enumerating all coalitions is preferable to the dynamic programs
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param table_size The number of weights of the dense table
+	 * @param rows The number of rows of the dense table (e.g. the number of non-zero players if it tracks the cardinalities)
+	 * @return true if the game has at most cMaxPlayers non-zero players and its 2^n coalitions are at least cMinDenseFactor times fewer than the weights the dynamic programs would process (n * rows * table_size)
+	 */
+	static bool isPreferable(Game* g, bigInt table_size, longUInt rows);
+
+	/**
+	 * Checking whether an index enumerates all coalitions (see isPreferable()), i.e. the calculation needs no setup
+	 *
+	 * @param short_name The short name of the index (see IndexFactory)
+	 * @param g The Game object for the current calculation
+	 * @return true if the index is supported (BZ, BZB, ABZ, RBZ, RBZB, SH, SHB, RSH, RSHB, PG, RPG, DP, RDP, W and WM) and its index class prefers the enumeration for this game
+	 */
+	static bool isApplicable(const std::string& short_name, Game* g);
+
+	/**
+	 * An upper bound for the values the supported indices handle as LargeNumber if isApplicable() is true: all of them are numbers of coalitions of the non-zero players or sums of such numbers over the players.
+	 *
+	 * @param g The Game object for the current calculation
+	 * @return n * 2^n for n non-zero players
+	 */
+	static bigInt getMaxValueRequirement(Game* g);
+
+	/**
+	 * Calculating how often each non-zero player is a swing player (see RawBanzhaf)
+	 *
+	 * @param n_sp A return array. The array must be allocated at least in the range [0, g.getNumberOfNonZeroPlayers() - 1]!
+	 */
+	static void swingsPerPlayer(Game* g, lint::LargeNumber n_sp[]);
+
+	/**
+	 * Calculating how often each non-zero player is a swing player in coalitions of certain cardinalities (see RawShapleyShubik)
+	 *
+	 * @param raw_ssi A matrix where the calculated values will be stored. raw_ssi(x, y): amount of winning coalitions of cardinality y for which player x is a swing player. The matrix must be allocated in at least the range [0, numberOfNonZeroPlayers - 1] x [0, numberOfNonZeroPlayers].
+	 */
+	static void swingsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& raw_ssi);
+
+	/**
+	 * Calculating the number of minimal winning coalitions each non-zero player is member of (see RawPublicGood)
+	 *
+	 * @param mwc A return array. The array must be allocated at least in the range [0, g.getNumberOfNonZeroPlayers() - 1]!
+	 */
+	static void minimalWinningCoalitionsPerPlayer(Game* g, lint::LargeNumber mwc[]);
+
+	/**
+	 * Calculating the number of minimal winning coalitions of certain cardinalities each non-zero player is member of (see RawDeeganPackel)
+	 *
+	 * @param mwc A matrix where the calculated values will be stored. mwc(x, y): amount of minimal winning coalitions of cardinality y containing player x. The matrix must be allocated in at least the range [0, numberOfNonZeroPlayers - 1] x [0, numberOfNonZeroPlayers].
+	 */
+	static void minimalWinningCoalitionsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& mwc);
+
+	/**
+	 * Calculating the number of winning coalitions of the non-zero players (see SingleValueW)
+	 *
+	 * @param total_wc The LargeNumber the result gets assigned to
+	 */
+	static void numberOfWinningCoalitions(Game* g, lint::LargeNumber& total_wc);
+
+	/**
+	 * Calculating the total number of minimal winning coalitions (see MinimalWinningCoalitions::totalNumberOfMinimalWinningCoalitions())
+	 *
+	 * @param total_mwc The total number of minimal winning coalitions
+	 */
+	static void totalNumberOfMinimalWinningCoalitions(Game* g, bigInt* total_mwc);
+
+	/**
+	 * Getting the memory the enumeration needs (without the return arrays)
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param rows 1 for the counts per player, the number of non-zero players for the counts per player and cardinality
+	 * @return The memory requirement in Bytes
+	 */
+	static bigInt getMemoryRequirement(Game* g, longUInt rows);
+
+private:
+	/**
+	 * The maximum number of non-zero players
+	 */
+	static constexpr longUInt cMaxPlayers = 20;
+
+	/**
+	 * The number of players whose coalitions form the lanes
+	 */
+	static constexpr longUInt cLanePlayers = 4;
+
+	/**
+	 * The minimum factor the weights of the dynamic programs must exceed the number of coalitions (see isPreferable()). Inspecting a coalition costs more than updating a weight of a table.
+	 */
+	static constexpr longUInt cMinDenseFactor = 8;
+
+	/**
+	 * Enumerating all coalitions of the non-zero players
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param minimal If false, the swings get counted, otherwise the memberships of the minimal winning coalitions
+	 * @param rows 0 to count nothing per player, 1 to sum up all cardinalities, the number of non-zero players + 1 otherwise
+	 * @param counts Return vector: counts[i * rows + c] is the number of (minimal) winning coalitions of cardinality c player i is a swing player of (member of), only the column 0 gets used if rows is 1
+	 * @return The number of winning coalitions if minimal is false, the number of minimal winning coalitions otherwise
+	 */
+	static longUInt enumerate(Game* g, bool minimal, longUInt rows, std::vector<longUInt>& counts);
+};
+
+} /* namespace epic::index */
+
+#endif /* EPIC_INDEX_SMALLGAME_H_ */
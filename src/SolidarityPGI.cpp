@@ -1,7 +1,7 @@
 #include "SolidarityPGI.h"
 
 #include "Logging.h"
-#include "PublicGood.h"
+#include "PublicGoodSolver.h"
 #include "GlobalCalculator.h"
 
 epic::index::SolidarityPGI::SolidarityPGI()
@@ -12,14 +12,9 @@ std::vector<epic::bigFloat> epic::index::SolidarityPGI::calculate(Game* g_) {
 	std::vector<bigFloat> solution(g->getNumberOfPlayers());
 
 	std::vector<bigFloat> externalSolution(g->getNumberOfPrecoalitions());
-	{ // calculate external game
-		PublicGood* pgi = new PublicGood();
-		// Create game object from weights of precoalitions with original quota
-		auto precoalitionGame = new Game(g->getQuota(), g->getPrecoalitionWeights(), false);
-		pgi->calculate(precoalitionGame, externalSolution);
-
-		delete precoalitionGame;
-		delete pgi;
+	{ // calculate external game: weights of precoalitions with original quota
+		PublicGoodSolver pgi;
+		pgi.calculate(g->getPrecoalitionWeights(), g->getQuota(), externalSolution);
 	}
 
 	for (longUInt i = 0; i < g->getNumberOfPrecoalitions(); i++) {
@@ -43,6 +38,7 @@ epic::longUInt epic::index::SolidarityPGI::getMemoryRequirement(Game* g_) {
 	bigInt memory = (g->getWeightSum() + 1 - g->getQuota()) * gCalculator->getLargeNumberSize();
 	memory += g->getMaxPrecoalitionSize() * gCalculator->getLargeNumberSize();
 	memory += g->getMaxPrecoalitionSize() * c_sizeof_longUInt;
+	memory += PublicGoodSolver::getMemoryRequirement(g->getNumberOfPrecoalitions(), g->getQuota()); // external game
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
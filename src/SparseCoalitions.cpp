@@ -0,0 +1,230 @@
+#include "SparseCoalitions.h"
+
+#include "GlobalCalculator.h"
+#include "Logging.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+epic::index::SparseCoalitions::SparseCoalitions(longUInt capacity, longUInt rows, longUInt max_weight)
+	: mCapacity(capacity), mRows(rows), mMaxWeight(max_weight), mSize(0), mWeights(capacity), mMergeCounts(nullptr) {
+	mCounts = new lint::LargeNumber[mCapacity * mRows];
+	gCalculator->alloc_largeNumberArray(mCounts, mCapacity * mRows);
+}
+
+epic::index::SparseCoalitions::~SparseCoalitions() {
+	gCalculator->free_largeNumberArray(mCounts);
+	delete[] mCounts;
+
+	if (mMergeCounts != nullptr) {
+		gCalculator->free_largeNumberArray(mMergeCounts);
+		delete[] mMergeCounts;
+	}
+}
+
+void epic::index::SparseCoalitions::assignEmptyCoalition() {
+	mSize = 0;
+	if (mMaxWeight > 0) {
+		mWeights[0] = 0;
+		gCalculator->assign_zero(mCounts, mRows);
+		gCalculator->assign_one(mCounts[0]);
+		mSize = 1;
+	}
+}
+
+void epic::index::SparseCoalitions::assign(const SparseCoalitions& other) {
+	mSize = other.mSize;
+	std::copy(other.mWeights.begin(), other.mWeights.begin() + mSize, mWeights.begin());
+	gCalculator->assign(mCounts, other.mCounts, mSize * mRows);
+}
+
+void epic::index::SparseCoalitions::addPlayer(longUInt w) {
+	if (mMergeCounts == nullptr) {
+		mMergeWeights.resize(mCapacity);
+		mMergeCounts = new lint::LargeNumber[mCapacity * mRows];
+		gCalculator->alloc_largeNumberArray(mMergeCounts, mCapacity * mRows);
+	}
+
+	// the cardinality of the shifted coalitions grows by one (if the cardinalities get tracked)
+	longUInt shift = (mRows > 1) ? 1 : 0;
+
+	/*
+	 * Merging the coalitions without the player (a) and the ones with the player (b: the same weights shifted by w, as long as they stay below the maximum weight)
+	 */
+	longUInt a = 0;
+	longUInt b = 0;
+	longUInt size = 0;
+	while (a < mSize || (b < mSize && mWeights[b] + w < mMaxWeight)) {
+		if (size == mCapacity) {
+			throw std::runtime_error("SparseCoalitions: the number of coalition weights exceeds the capacity.");
+		}
+
+		bool has_b = b < mSize && mWeights[b] + w < mMaxWeight;
+		lint::LargeNumber* dest = &mMergeCounts[size * mRows];
+
+		if (a < mSize && (!has_b || mWeights[a] < mWeights[b] + w)) {
+			mMergeWeights[size] = mWeights[a];
+			gCalculator->assign(dest, &mCounts[a * mRows], mRows);
+			++a;
+		} else {
+			mMergeWeights[size] = mWeights[b] + w;
+			if (a < mSize && mWeights[a] == mWeights[b] + w) {
+				gCalculator->assign(dest, &mCounts[a * mRows], mRows);
+				++a;
+			} else {
+				gCalculator->assign_zero(dest, mRows);
+			}
+			gCalculator->plusEqual(dest + shift, &mCounts[b * mRows], mRows - shift);
+			++b;
+		}
+		++size;
+	}
+
+	mSize = size;
+	std::swap(mWeights, mMergeWeights);
+	std::swap(mCounts, mMergeCounts);
+}
+
+void epic::index::SparseCoalitions::removePlayer(longUInt w) {
+	longUInt shift = (mRows > 1) ? 1 : 0;
+
+	// p: the entry of weight mWeights[k] - w (if it exists), it already got updated since its weight is smaller
+	longUInt p = 0;
+	for (longUInt k = 0; k < mSize; ++k) {
+		if (mWeights[k] < w) {
+			continue;
+		}
+
+		longUInt target = mWeights[k] - w;
+		while (mWeights[p] < target) {
+			++p;
+		}
+		if (mWeights[p] == target) {
+			gCalculator->minus(&mCounts[k * mRows + shift], &mCounts[k * mRows + shift], &mCounts[p * mRows], mRows - shift);
+		}
+	}
+}
+
+void epic::index::SparseCoalitions::sum(lint::LargeNumber* dest, longUInt begin, longUInt end) const {
+	longUInt k = std::lower_bound(mWeights.begin(), mWeights.begin() + mSize, begin) - mWeights.begin();
+	for (; k < mSize && mWeights[k] < end; ++k) {
+		gCalculator->plusEqual(dest, &mCounts[k * mRows], mRows);
+	}
+}
+
+epic::bigInt epic::index::SparseCoalitions::getCapacity(Game* g, longUInt max_weight) {
+	bigInt capacity = g->getMaxNumberOfCoalitionWeights();
+	if (capacity > max_weight) {
+		capacity = max_weight;
+	}
+	return capacity;
+}
+
+bool epic::index::SparseCoalitions::isPreferable(Game* g, bigInt dense_size) {
+	return getCapacity(g, g->getQuota()) * cMinDenseFactor <= dense_size;
+}
+
+void epic::index::SparseCoalitions::swingsPerPlayer(Game* g, lint::LargeNumber n_sp[]) {
+	longUInt quota = g->getQuota();
+	longUInt capacity = getCapacity(g, quota).get_ui();
+	log::out << log::info << "Using sparse coalition tables (at most " << capacity << " coalition weights)" << log::endl;
+
+	SparseCoalitions all(capacity, 1, quota);
+	all.assignEmptyCoalition();
+	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+		all.addPlayer(g->getWeights()[i]);
+	}
+
+	SparseCoalitions without(capacity, 1, quota);
+	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+		longUInt wi = g->getWeights()[i];
+
+		// players of the same weight have the same swings
+		if (i > 0 && wi == g->getWeights()[i - 1]) {
+			gCalculator->plusEqual(n_sp[i], n_sp[i - 1]);
+			continue;
+		}
+
+		without.assign(all);
+		without.removePlayer(wi);
+		without.sum(&n_sp[i], (quota > wi) ? quota - wi : 0, quota);
+	}
+}
+
+void epic::index::SparseCoalitions::swingsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& raw_ssi) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+	longUInt quota = g->getQuota();
+	longUInt capacity = getCapacity(g, quota).get_ui();
+	log::out << log::info << "Using sparse coalition tables (at most " << capacity << " coalition weights)" << log::endl;
+
+	// the cardinalities 0, ..., n - 1 suffice: the only coalition of cardinality n is the grand coalition which is winning
+	SparseCoalitions all(capacity, n, quota);
+	all.assignEmptyCoalition();
+	for (longUInt i = 0; i < n; ++i) {
+		all.addPlayer(g->getWeights()[i]);
+	}
+
+	SparseCoalitions without(capacity, n, quota);
+	for (longUInt i = 0; i < n; ++i) {
+		longUInt wi = g->getWeights()[i];
+
+		// players of the same weight have the same swings
+		if (i > 0 && wi == g->getWeights()[i - 1]) {
+			gCalculator->plusEqual(&raw_ssi(i, 1), &raw_ssi(i - 1, 1), n);
+			continue;
+		}
+
+		// a coalition of cardinality c not containing i turns into a winning coalition of cardinality c + 1
+		without.assign(all);
+		without.removePlayer(wi);
+		without.sum(&raw_ssi(i, 1), (quota > wi) ? quota - wi : 0, quota);
+	}
+}
+
+void epic::index::SparseCoalitions::minimalWinningCoalitionsPerPlayer(Game* g, lint::LargeNumber mwc[]) {
+	longUInt quota = g->getQuota();
+	longUInt capacity = getCapacity(g, quota).get_ui();
+	log::out << log::info << "Using sparse coalition tables (at most " << capacity << " coalition weights)" << log::endl;
+
+	// total: number of minimal winning coalitions of the current last player j, window: the ones not containing player i
+	lint::LargeNumber total, window;
+	gCalculator->alloc_largeNumber(total);
+	gCalculator->alloc_largeNumber(window);
+
+	// f: the coalitions of the players 0, ..., j - 1
+	SparseCoalitions f(capacity, 1, quota);
+	SparseCoalitions without(capacity, 1, quota);
+	f.assignEmptyCoalition();
+
+	for (longUInt j = 0; j < g->getNumberOfNonZeroPlayers(); ++j) {
+		longUInt wj = g->getWeights()[j];
+		longUInt begin = (quota > wj) ? quota - wj : 0;
+
+		gCalculator->assign_zero(total);
+		f.sum(&total, begin, quota);
+		gCalculator->plusEqual(mwc[j], total);
+
+		for (longUInt i = 0; i < j; ++i) {
+			// removing a player of the same weight gives the same coalitions
+			if (i == 0 || g->getWeights()[i] != g->getWeights()[i - 1]) {
+				without.assign(f);
+				without.removePlayer(g->getWeights()[i]);
+				gCalculator->assign_zero(window);
+				without.sum(&window, begin, quota);
+			}
+
+			gCalculator->plusEqual(mwc[i], total);
+			gCalculator->minusEqual(mwc[i], window);
+		}
+
+		f.addPlayer(wj);
+	}
+
+	gCalculator->free_largeNumber(window);
+	gCalculator->free_largeNumber(total);
+}
+
+epic::bigInt epic::index::SparseCoalitions::getMemoryRequirement(Game* g, longUInt rows) {
+	// three vectors: both buffers of the one all players get added to, the copy players get removed from
+	return getCapacity(g, g->getQuota()) * (rows * gCalculator->getLargeNumberSize() + c_sizeof_longUInt) * 3;
+}
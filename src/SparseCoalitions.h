@@ -0,0 +1,148 @@
+#ifndef EPIC_INDEX_SPARSECOALITIONS_H_
+#define EPIC_INDEX_SPARSECOALITIONS_H_
+
+#include "Array.h"
+#include "Game.h"
+#include "LargeNumber.h"
+#include "types.h"
+
+#include <vector>
+
+namespace epic::index {
+
+/**
+ * The number of coalitions per weight (and optionally per cardinality) stored as a sorted sparse vector of the reachable weights.
+ *
+ * The dense tables of the other indices get indexed by the coalition weight, i.e. their size is about the quota or the weight sum. For weights like population or share counts those tables do not fit into the memory even after dividing by the gcd (see SystemControlUnit::createGamefromInputAndMinimiseWeights()), while n players only reach at most 2^n different coalition weights. This class only stores the reachable weights (in increasing order) and their counts. Adding a player merges the vector with a copy of itself shifted by the player's weight, removing a player reverts that in place.
+ *
+ * Only the coalitions of weight less than the maximum weight given at construction time get tracked. The dynamic programs (see swingsPerPlayer(), swingsPerPlayerAndCardinality() and minimalWinningCoalitionsPerPlayer()) count the losing coalitions, i.e. the maximum weight is the quota.
+ *
+ * @note The tables get allocated using gCalculator, i.e. the object must get deleted before gCalculator gets removed.
+ */
+class SparseCoalitions {
+public:
+	/**
+	 * Creating an empty vector (no coalition at all)
+	 *
+	 * @param capacity The maximum number of weights the vector can store (see getCapacity())
+	 * @param rows The number of cardinalities to track (the coalitions of cardinality 0, ..., rows - 1). If 1, the cardinalities get summed up.
+	 * @param max_weight Only the coalitions of weight less than max_weight get tracked
+	 */
+	SparseCoalitions(longUInt capacity, longUInt rows, longUInt max_weight);
+	~SparseCoalitions();
+
+	SparseCoalitions(const SparseCoalitions&) = delete;
+	SparseCoalitions& operator=(const SparseCoalitions&) = delete;
+
+	/**
+	 * Resetting the vector to the empty coalition only (weight 0, cardinality 0)
+	 */
+	void assignEmptyCoalition();
+
+	/**
+	 * Copying the weights and counts of another vector of the same dimensions
+	 */
+	void assign(const SparseCoalitions& other);
+
+	/**
+	 * Adding a player of weight w to all coalitions, i.e. h(x, c) += h(x - w, c - 1) (h(x) += h(x - w) if the cardinalities get summed up)
+	 */
+	void addPlayer(longUInt w);
+
+	/**
+	 * Removing a player of weight w from all coalitions (the inverse of addPlayer()), i.e. h(x, c) -= h(x - w, c - 1) in increasing order of x
+	 *
+	 * @note The player must have been added before.
+	 */
+	void removePlayer(longUInt w);
+
+	/**
+	 * dest[c] += the number of coalitions of cardinality c whose weight is in [begin, end) for c in [0, rows)
+	 */
+	void sum(lint::LargeNumber* dest, longUInt begin, longUInt end) const;
+
+	/**
+	 * Getting the maximum number of different weights in [0, max_weight) the coalitions of the non-zero players (or any subset of them) can reach
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param max_weight see SparseCoalitions()
+	 * @return The minimum of max_weight and Game::getMaxNumberOfCoalitionWeights()
+	 */
+	static bigInt getCapacity(Game* g, longUInt max_weight);
+
+	/**
+	 * Checking whether the sparse vectors are preferable to a dense table
+	 *
+	 * The passes over a sparse vector touch each of its weights about as often as the dense dynamic programs touch each weight of their tables, but each access is more expensive (merging, searching the shifted weights). Therefore the sparse vectors only get used if their capacity is at least cMinDenseFactor times smaller than the dense table.
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param dense_size The number of weights the dense table would need
+	 */
+	static bool isPreferable(Game* g, bigInt dense_size);
+
+	/**
+	 * Calculating how often each non-zero player is a swing player (see RawBanzhaf)
+	 *
+	 * A coalition of weight x not containing player i turns winning by adding i iff x is in [quota - wi, quota). Removing player i from the losing coalitions of all players gives the losing coalitions not containing i.
+	 *
+	 * @param n_sp A return array. The array must be allocated and zero-initialized at least in the range [0, g.getNumberOfNonZeroPlayers() - 1]!
+	 */
+	static void swingsPerPlayer(Game* g, lint::LargeNumber n_sp[]);
+
+	/**
+	 * Calculating how often each non-zero player is a swing player in coalitions of certain cardinalities (see RawShapleyShubik)
+	 *
+	 * @param raw_ssi A matrix where the calculated values will be stored. raw_ssi(x, y): amount of coalitions of cardinality y for which player x is a swing player. The matrix must be allocated and zero initialized in at least the range [0, numberOfNonZeroPlayers - 1] x [0, numberOfNonZeroPlayers].
+	 */
+	static void swingsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& raw_ssi);
+
+	/**
+	 * Calculating the number of minimal winning coalitions each non-zero player is member of (see RawPublicGood)
+	 *
+	 * Each minimal winning coalition S gets counted for its last player j (the one of the highest index, i.e. one of its lightest players): S is minimal winning iff the other members (players 0, ..., j - 1) have a weight in [quota - wj, quota). Player i < j is member of those coalitions unless they belong to the coalitions of the players 0, ..., j - 1 without i.
+	 *
+	 * @param mwc A return array. The array must be allocated and zero-initialized at least in the range [0, g.getNumberOfNonZeroPlayers() - 1]!
+	 */
+	static void minimalWinningCoalitionsPerPlayer(Game* g, lint::LargeNumber mwc[]);
+
+	/**
+	 * Getting the memory swingsPerPlayer(), swingsPerPlayerAndCardinality() or minimalWinningCoalitionsPerPlayer() needs (without the return arrays)
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param rows 1 for swingsPerPlayer() and minimalWinningCoalitionsPerPlayer(), the number of non-zero players for swingsPerPlayerAndCardinality()
+	 * @return The memory requirement in Bytes
+	 */
+	static bigInt getMemoryRequirement(Game* g, longUInt rows);
+
+private:
+	/**
+	 * The minimum factor the capacity must be smaller than the dense table (see isPreferable())
+	 */
+	static constexpr longUInt cMinDenseFactor = 8;
+
+	longUInt mCapacity;
+	longUInt mRows;
+	longUInt mMaxWeight;
+
+	/**
+	 * The number of weights currently stored
+	 */
+	longUInt mSize;
+
+	/**
+	 * mWeights[k]: the k-th reachable weight (increasing)
+	 * mCounts[k * mRows + c]: the number of coalitions of weight mWeights[k] and cardinality c
+	 */
+	std::vector<longUInt> mWeights;
+	lint::LargeNumber* mCounts;
+
+	/**
+	 * The target of the merge in addPlayer() (allocated on its first call)
+	 */
+	std::vector<longUInt> mMergeWeights;
+	lint::LargeNumber* mMergeCounts;
+};
+
+} /* namespace epic::index */
+
+#endif /* EPIC_INDEX_SPARSECOALITIONS_H_ */
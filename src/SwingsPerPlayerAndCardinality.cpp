@@ -1,12 +1,26 @@
 #include "SwingsPerPlayerAndCardinality.h"
 
 #include "GlobalCalculator.h"
+#include "HardwareInfo.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <vector>
 
 epic::index::SwingsPerPlayerAndCardinality::SwingsPerPlayerAndCardinality()
 	: ItfPowerIndex() {}
 
 epic::longUInt epic::index::SwingsPerPlayerAndCardinality::getMemoryRequirement(Game* g) {
-	bigInt memory = bigInt(g->getWeightSum() + 1 - g->getQuota()) * (g->getNumberOfNonZeroPlayers() + 1) * gCalculator->getLargeNumberSize() * 2; // n_wc, helper_wc
+	longUInt n = g->getNumberOfNonZeroPlayers();
+	bigInt table_size = bigInt(g->getWeightSum() + 1 - g->getQuota()) * (n + 1) * gCalculator->getLargeNumberSize();
+	bigInt thread_size = bigInt(2 * (n + 1)) * gCalculator->getLargeNumberSize(); // block_sums
+	if (g->getWeights()[n - 1] < cMinWindowWeight) {
+		thread_size += table_size; // helper_wc
+	}
+	longUInt number_of_threads = thread_size.fits_ulong_p() ? Parallel::getNumberOfThreads(n, thread_size.get_ui()) : 1;
+
+	bigInt memory = table_size * 2 + bigInt(n + 1) * gCalculator->getLargeNumberSize(); // n_wc, suffix
+	memory += thread_size * number_of_threads;
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
@@ -18,8 +32,13 @@ epic::longUInt epic::index::SwingsPerPlayerAndCardinality::getMemoryRequirement(
 }
 
 void epic::index::SwingsPerPlayerAndCardinality::numberOfWinningCoalitionsPerWeightAndCardinality(Game* g, Array2dOffset<lint::LargeNumber>& n_wc) {
+	longUInt n = g->getNumberOfNonZeroPlayers();
+	longUInt quota = g->getQuota();
+	longUInt weightsum = g->getWeightSum();
+	const std::vector<longUInt>& weights = g->getWeights();
+
 	// initialize the grand coalition (weight = weightsum, cardinality = numberofplayers) with 1, since it is always winning
-	gCalculator->assign_one(n_wc(g->getWeightSum(), g->getNumberOfNonZeroPlayers()));
+	gCalculator->assign_one(n_wc(weightsum, n));
 
 	/*
 	 * Find out winning coalitions per weight sum and cardinality. Iterate from the weight = quota + wi upwards since a coalition of that weight is guaranteed to be a winning coalition even without player i.
@@ -30,32 +49,131 @@ void epic::index::SwingsPerPlayerAndCardinality::numberOfWinningCoalitionsPerWei
 	 * The difference to the Banzhaf calculation is only the second for-loop for the cardinality.
 	 *
 	 * The value n_wc[k][m] is then added to the coalition count of n_wc[k - wi][m - 1], since the coalition loses player i's weight (k - wi) and one player (m - 1).
+	 *
+	 * Instead of a pass over the whole table per player, the passes of several consecutive players get interleaved (temporal blocking): Player i updates the target weight t = k - wi as soon as player i - 1 has updated the weight t + wi, i.e. each player trails its predecessor by its own weight. The targets get processed in increasing order, so each player still reads the weights t + wi before it overwrites them. A group of players whose weights sum up to s touches about s + step weights per round, where step is the number of targets the first player of the group advances. Both get chosen such that these rows fit into the cache (see getCacheRows()). Players heavier than half of the cache form a group on their own, i.e. a plain pass.
 	 */
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
-		longUInt wi = g->getWeights()[i];
+	longUInt cache_rows = getCacheRows(n);
+	longUInt step = std::max(cache_rows / 2, longUInt{1});
+
+	// next[i]: all targets of player i in [quota, next[i]) are done
+	std::vector<longUInt> next(n);
 
-		for (longUInt k = g->getQuota() + wi; k <= g->getWeightSum(); ++k) {
-			for (longUInt m = 1; m <= g->getNumberOfNonZeroPlayers(); ++m) {
-				gCalculator->plusEqual(n_wc(k - wi, m - 1), n_wc(k, m));
+	for (longUInt first = 0, last; first < n; first = last) {
+		// the group [first, last)
+		longUInt span = weights[first];
+		for (last = first + 1; last < n && span + weights[last] <= cache_rows / 2; ++last) {
+			span += weights[last];
+		}
+		std::fill(next.begin() + first, next.begin() + last, quota);
+
+		bool done = false;
+		for (longUInt front = quota + step; !done; front += step) {
+			// limit: all weights below limit are final for the current player (the targets of the previous player are done)
+			longUInt limit = front;
+			done = true;
+
+			for (longUInt i = first; i < last; ++i) {
+				longUInt wi = weights[i];
+				longUInt end = weightsum + 1 - wi; // the targets of player i: [quota, weightsum - wi]
+				longUInt stop = std::min(end, (limit > wi) ? limit - wi : 0);
+
+				for (; next[i] < stop; ++next[i]) {
+					gCalculator->plusEqual(&n_wc(next[i], 0), &n_wc(next[i] + wi, 1), n);
+				}
+
+				if (next[i] >= end) {
+					limit = weightsum + 1;
+				} else {
+					limit = next[i];
+					done = false;
+				}
 			}
 		}
 	}
 }
 
+epic::longUInt epic::index::SwingsPerPlayerAndCardinality::getCacheRows(longUInt n) {
+	static const longUInt cache_size = HardwareInfo().getCacheSize();
+
+	// about half of the cache: the rows of n_wc get read and written
+	longUInt bytes = ((cache_size > 0) ? cache_size : cDefaultCacheSize) * cMemUnit_factor / 2;
+	return bytes / ((n + 1) * gCalculator->getLargeNumberSize());
+}
+
 void epic::index::SwingsPerPlayerAndCardinality::swingsPerPlayerAndCardinality(Game* g, Array2dOffset<lint::LargeNumber>& n_wc, Array2d<lint::LargeNumber>& raw_ssi, bool only_swingplayer) {
-	// helper_wc(x, y): helper matrix for n_wc
-	Array2dOffset<lint::LargeNumber> helper(g->getWeightSum() + 1, g->getNumberOfNonZeroPlayers() + 1, g->getQuota(), 0);
-	gCalculator->allocInit_largeNumberArray(helper.getArrayPointer(), helper.getNumberOfElements());
+	longUInt n = g->getNumberOfNonZeroPlayers();
+
+	/*
+	 * suffix(k, p): number of winning coalitions of weight >= k and cardinality p (suffix(weightsum + 1, p) = 0)
+	 *
+	 * Unrolling the recursion of the helper matrix below gives helper_wc[k][p] = sum_j (-1)^j * n_wc[k + j * wi][p + j]. Summing it up over the window [quota, end) only needs the block sums of the blocks [quota + j * wi, end + j * wi), i.e.
+	 *
+	 * sum_{k = quota}^{end - 1} helper_wc[k][p] = sum_j (-1)^j * (suffix(quota + j * wi, p + j) - suffix(end + j * wi, p + j))
+	 *
+	 * For players of weight >= cMinWindowWeight this needs about 2 * (weightsum - quota) / wi span operations instead of a pass over the whole range [quota, weightsum] and no helper matrix. The even and the odd blocks get summed up separately such that no intermediate value gets negative.
+	 */
+	Array2dOffset<lint::LargeNumber> suffix(g->getWeightSum() + 2, n + 1, g->getQuota(), 0);
+	gCalculator->allocInit_largeNumberArray(suffix.getArrayPointer(), suffix.getNumberOfElements());
+	for (longUInt k = g->getWeightSum(); k >= g->getQuota(); --k) {
+		gCalculator->assign(&suffix(k, 0), &suffix(k + 1, 0), n + 1);
+		gCalculator->plusEqual(&suffix(k, 0), &n_wc(k, 0), n + 1);
+	}
+
+	/*
+	 * The passes of the players are independent of each other: They only read n_wc and write into their own row of raw_ssi. Therefore the players get distributed onto multiple threads, each thread using its own helper matrix.
+	 */
+	bool use_helper = g->getWeights()[n - 1] < cMinWindowWeight;
+	longUInt helper_size = use_helper ? (g->getWeightSum() + 1 - g->getQuota()) * (n + 1) : 0;
+	longUInt number_of_threads = Parallel::getNumberOfThreads(n, (helper_size + 2 * (n + 1)) * gCalculator->getLargeNumberSize());
+
+	// helper_wc(x, y): helper matrix for n_wc (one per thread, only needed for the players lighter than cMinWindowWeight)
+	std::vector<Array2dOffset<lint::LargeNumber>> helpers(number_of_threads);
+	// block_sums(0, y), block_sums(1, y): sums of the even and the odd blocks (one per thread)
+	std::vector<Array2d<lint::LargeNumber>> block_sums(number_of_threads);
+	for (longUInt t = 0; t < number_of_threads; ++t) {
+		if (use_helper) {
+			helpers[t].alloc(g->getWeightSum() + 1, n + 1, g->getQuota(), 0);
+			gCalculator->allocInit_largeNumberArray(helpers[t].getArrayPointer(), helpers[t].getNumberOfElements());
+		}
+		block_sums[t].alloc(2, n + 1);
+		gCalculator->alloc_largeNumberArray(block_sums[t].getArrayPointer(), 2 * (n + 1));
+	}
 
-	for (longUInt i = 0; i < g->getNumberOfNonZeroPlayers(); ++i) {
+	Parallel::for_each(n, number_of_threads, [&](longUInt thread_id, longUInt i) {
 		longUInt wi = g->getWeights()[i]; // all weights are greater than zero!
 
-		// quota - 1 is only the maximum if player i is a veto player
-		longUInt m = std::max(g->getWeightSum() - wi, g->getQuota() - 1);
-		for (longUInt k = g->getWeightSum(); k > m; --k) {
-			for (longUInt p = 1; p <= g->getNumberOfNonZeroPlayers(); ++p) {
-				gCalculator->assign(helper(k, p), n_wc(k, p));
+		/*
+		 * m is the end of the range, where player i stops be a swing player and we therefore stop adding the number of coalitions with a certain weight and size to our count for player i.
+		 * weightsum + 1 is only ever reached if player i is a veto player, being in every coalition from the quota to weightsum + 1 that is winning.
+		 */
+		longUInt m = only_swingplayer ? std::min(g->getWeightSum() + 1, g->getQuota() + wi) : g->getWeightSum() + 1;
+
+		if (wi >= cMinWindowWeight) {
+			Array2d<lint::LargeNumber>& sums = block_sums[thread_id];
+			gCalculator->assign_zero(sums.getArrayPointer(), 2 * (n + 1));
+
+			// block j shifts the cardinality by j, i.e. only the cardinalities [1, n - j] of raw_ssi get affected
+			for (longUInt j = 0, begin = g->getQuota(); j < n && begin <= g->getWeightSum(); ++j, begin += wi) {
+				lint::LargeNumber* block_sum = sums.getArray(j % 2);
+				longUInt end = std::min(m + j * wi, g->getWeightSum() + 1);
+
+				gCalculator->plusEqual(&block_sum[1], &suffix(begin, 1 + j), n - j);
+				if (end <= g->getWeightSum()) {
+					gCalculator->minus(&block_sum[1], &block_sum[1], &suffix(end, 1 + j), n - j);
+				}
 			}
+
+			gCalculator->minus(&sums(0, 1), &sums(0, 1), &sums(1, 1), n);
+			gCalculator->plusEqual(&raw_ssi(i, 1), &sums(0, 1), n);
+			return;
+		}
+
+		Array2dOffset<lint::LargeNumber>& helper = helpers[thread_id];
+
+		// quota - 1 is only the maximum if player i is a veto player
+		longUInt l = std::max(g->getWeightSum() - wi, g->getQuota() - 1);
+		for (longUInt k = g->getWeightSum(); k > l; --k) {
+			gCalculator->assign(&helper(k, 1), &n_wc(k, 1), n);
 		}
 
 		/*
@@ -71,24 +189,21 @@ void epic::index::SwingsPerPlayerAndCardinality::swingsPerPlayerAndCardinality(G
 		 * The only difference to the Banzhaf calculation is the second for loop for the cardinalities.
 		 */
 		for (longUInt k = g->getWeightSum() - wi; k >= g->getQuota(); --k) {
-			for (longUInt p = 0; p < g->getNumberOfNonZeroPlayers(); ++p) {
-				gCalculator->minus(helper(k, p), n_wc(k, p), helper(k + wi, p + 1));
-			}
+			gCalculator->minus(&helper(k, 0), &n_wc(k, 0), &helper(k + wi, 1), n);
 		}
 
-		/*
-		 * m is the end of the range, where player i stops be a swing player and we therefore stop adding the number of coalitions with a certain weight and size to our count for player i.
-		 * weightsum + 1 is only ever reached if player i is a veto player, being in every coalition from the quota to weightsum + 1 that is winning.
-		 */
-		m = only_swingplayer ? std::min(g->getWeightSum() + 1, g->getQuota() + wi) : g->getWeightSum() + 1;
 		for (longUInt k = g->getQuota(); k < m; ++k) {
-			for (longUInt p = 1; p <= g->getNumberOfNonZeroPlayers(); ++p) {
-				gCalculator->plusEqual(raw_ssi(i, p), helper(k, p));
-			}
+			gCalculator->plusEqual(&raw_ssi(i, 1), &helper(k, 1), n);
 		}
-	}
+	});
 
-	gCalculator->free_largeNumberArray(helper.getArrayPointer());
+	for (longUInt t = 0; t < number_of_threads; ++t) {
+		if (use_helper) {
+			gCalculator->free_largeNumberArray(helpers[t].getArrayPointer());
+		}
+		gCalculator->free_largeNumberArray(block_sums[t].getArrayPointer());
+	}
+	gCalculator->free_largeNumberArray(suffix.getArrayPointer());
 }
 
 void epic::index::SwingsPerPlayerAndCardinality::swingsPerPlayerAndCardinality(Game* g, Array2d<lint::LargeNumber>& raw_ssi, bool only_swingplayer) {
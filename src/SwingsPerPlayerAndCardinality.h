@@ -50,6 +50,23 @@ protected:
 	 * @note The values for players of weight zero will remain zero (as initialized).
 	 */
 	void swingsPerPlayerAndCardinality(Game* g, Array2dOffset<lint::LargeNumber>& n_wc, Array2d<lint::LargeNumber>& raw_ssi, bool only_swingplayer = true);
+
+private:
+	/**
+	 * @param n The number of non-zero players
+	 * @return The number of rows (weights) of the n_wc matrix fitting into the cache of a core (see HardwareInfo::getCacheSize())
+	 */
+	static longUInt getCacheRows(longUInt n);
+
+	/**
+	 * The cache size (in <cMemUnit_name>) assumed if it is not readable from the system
+	 */
+	static constexpr longUInt cDefaultCacheSize = 256;
+
+	/**
+	 * The smallest weight for which the swings of a player get summed up blockwise from suffix sums of n_wc instead of by a pass over the whole range [quota, weightsum] (see swingsPerPlayerAndCardinality()). Both variants work on spans of n + 1 LargeNumbers, the blockwise sum only needs about 2 / wi of them.
+	 */
+	static constexpr longUInt cMinWindowWeight = 4;
 };
 
 } /* namespace epic::index */
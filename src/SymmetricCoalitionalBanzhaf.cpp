@@ -59,10 +59,7 @@ std::vector<epic::bigFloat> epic::index::SymmetricCoalitionalBanzhaf::calculate(
 
 		//get sum of vector
 		longUInt min = std::min(g->getQuota() + g->getPrecoalitionWeights()[i] - 1, g->getWeightSum());
-
-		for (longUInt iii = g->getQuota(); iii <= min; iii++) {
-			gCalculator->plusEqual(banzhafsExternalGame[i], cw[iii]);
-		}
+		gCalculator->plusEqualSum(banzhafsExternalGame[i], &cw[g->getQuota()], min + 1 - g->getQuota());
 
 		Array2dOffset<lint::LargeNumber> cw2;
 		cw2.alloc(totalWeight + 1, g->getMaxPrecoalitionSize() + 1, g->getQuota(), 0);
@@ -83,9 +80,7 @@ std::vector<epic::bigFloat> epic::index::SymmetricCoalitionalBanzhaf::calculate(
 					coalitionsCardinalityContainingPlayerFromAbove(g, cwi, cw2, nbPlayersInParti, ii, winternal);
 				} else {
 					for (longUInt x = g->getQuota(); x <= g->getWeightSum(); ++x) {
-						for (int y = 0; y < nbPlayersInParti; ++y) {
-							gCalculator->assign(cwi(x, y), cw2(x, y));
-						}
+						gCalculator->assign(&cwi(x, 0), &cw2(x, 0), nbPlayersInParti);
 					}
 				}
 				updateInternalShapleyShubik(g, shapleysInternal, cwi, i, ii, winternal, factorial);
@@ -151,9 +146,7 @@ void epic::index::SymmetricCoalitionalBanzhaf::updateInternalShapleyShubik(Preco
 	for (longUInt sinternal = 0; sinternal < n; ++sinternal) {
 		gCalculator->assign_zero(mTmp);
 		longUInt min = std::min(g->getQuota() + weights[player] - 1, g->getWeightSum());
-		for (longUInt w = g->getQuota(); w <= min; ++w) {
-			gCalculator->plusEqual(mTmp, cwi(w, sinternal));
-		}
+		gCalculator->plusEqualSum(mTmp, &cwi(g->getQuota(), sinternal), min + 1 - g->getQuota(), g->getMaxPrecoalitionSize()); // column sinternal of cwi
 
 		gCalculator->to_bigInt(&mBigTmp, mTmp);
 		internal_ssi[player] += (factorial[sinternal] * factorial[n - sinternal - 1]) * mBigTmp;
@@ -6,10 +6,15 @@
 #include "IndexFactory.h"
 #include "GlobalCalculator.h"
 #include "Logging.h"
+#include "MemoryTracker.h"
+#include "Parallel.h"
+#include "SmallGame.h"
 #include "types.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <vector>
 
@@ -56,27 +61,134 @@ epic::SystemControlUnit::~SystemControlUnit() {
 
 //specify and compute index
 void epic::SystemControlUnit::calculateIndex() {
-	index::ItfPowerIndex* index = index::IndexFactory::new_powerIndex(mUserInputHandler->getIndexToCompute(), mGame, mUserInputHandler->getIntRepresentation());
-	ItfUpperBoundApproximation* approx = new FastUpperBoundApproximation(*mGame);
-	lint::GlobalCalculator::init(lint::CalculatorConfig(index->getMaxValueRequirement(approx), index->getOperationRequirement(), mUserInputHandler->getIntRepresentation()));
+	// committee-sized games: the index enumerates all coalitions (see SmallGame), approximating the upper bound and checking the hardware would take longer than the calculation
+	if (index::SmallGame::isApplicable(mUserInputHandler->getIndexToCompute(), mGame)) {
+		std::string idx = mUserInputHandler->getIndexToCompute();
 
-	if (checkHardware(index->getMemoryRequirement(mGame))) {
-		log::out << log::info << "Start computation (" << index->getFullName() << ")" << log::endl
-				 << log::endl;
+		index::ItfPowerIndex* index = index::IndexFactory::new_powerIndex(idx, mGame, DEFAULT);
+		lint::GlobalCalculator::init(lint::CalculatorConfig(index::SmallGame::getMaxValueRequirement(mGame), index->getOperationRequirement(), DEFAULT));
 
-		std::string idx = mUserInputHandler->getIndexToCompute();
+		MemoryTracker::setLimit(mUserInputHandler->getMemoryLimit() * cMemUnit_factor);
+		Parallel::setNumberOfThreads(mUserInputHandler->getNumberOfThreads());
 
-		std::chrono::steady_clock::time_point t_begin = std::chrono::steady_clock::now();
-		if (idx == "W" || idx == "WM" || idx == "WS") { // single value calculation
-			mGame->setSingleValueSolution(index->calculate(mGame)[0]);
-		} else {
-			mGame->setSolution(index->calculate(mGame));
+		try {
+			std::chrono::steady_clock::time_point t_begin = std::chrono::steady_clock::now();
+			std::vector<bigFloat> solution = index->calculate(mGame);
+			std::chrono::steady_clock::time_point t_end = std::chrono::steady_clock::now();
+
+			if (idx == "W" || idx == "WM") { // single value calculation
+				mGame->setSingleValueSolution(solution[0]);
+			} else {
+				mGame->setSolution(solution);
+			}
+
+			log::out << log::info << "Calculation completed (" << std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_begin).count() << " µs)" << log::endl;
+		} catch (...) {
+			lint::GlobalCalculator::remove();
+			index::IndexFactory::delete_powerIndex(index);
+			throw;
 		}
-		std::chrono::steady_clock::time_point t_end = std::chrono::steady_clock::now();
 
-		log::out << log::info << "Calculation completed (" << std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_begin).count() << " µs)" << log::endl;
-	} else {
-		log::out << log::info << "Calculation aborted" << log::endl;
+		lint::GlobalCalculator::remove();
+		index::IndexFactory::delete_powerIndex(index);
+		return;
+	}
+
+	std::string idx = index::IndexFactory::selectFormulation(mUserInputHandler->getIndexToCompute(), mGame);
+	if (idx != mUserInputHandler->getIndexToCompute()) {
+		longUInt size_above = mGame->getWeightSum() + 1 - mGame->getQuota();
+		longUInt size_below = mGame->getReducedQuota();
+		log::out << log::info << "Calculating " << mUserInputHandler->getIndexToCompute() << " as " << idx << " (tables of " << std::min(size_above, size_below) << " instead of " << std::max(size_above, size_below) << " weights)" << log::endl;
+	}
+
+	// the floating-point representation only bounds the error of the normalized indices (ratios of non-negative combinations of the counts)
+	IntRepresentation int_representation = mUserInputHandler->getIntRepresentation();
+	if (int_representation == FLOAT && !(idx == "BZ" || idx == "BZB" || idx == "SH" || idx == "SHB" || idx == "PG" || idx == "DP")) {
+		log::out << log::warning << "The fast floating-point mode is only available for the indices BZ, SH, PG and DP. Calculating " << mUserInputHandler->getIndexToCompute() << " exactly." << log::endl;
+		int_representation = DEFAULT;
+	}
+
+	index::ItfPowerIndex* index = index::IndexFactory::new_powerIndex(idx, mGame, int_representation);
+	ItfUpperBoundApproximation* approx = new FastUpperBoundApproximation(*mGame);
+	lint::CalculatorConfig config(index->getMaxValueRequirement(approx), index->getOperationRequirement(), int_representation);
+	delete approx;
+
+	// try single integers first, most tables stay far below the approximated upper bound
+	lint::GlobalCalculator::init(config, true);
+
+	MemoryTracker::setLimit(mUserInputHandler->getMemoryLimit() * cMemUnit_factor);
+	Parallel::setNumberOfThreads(mUserInputHandler->getNumberOfThreads());
+
+	try {
+		bool calculate = checkHardware(index->getMemoryRequirement(mGame));
+		if (calculate) {
+			log::out << log::info << "Start computation (" << index->getFullName() << ")" << log::endl
+					 << log::endl;
+
+			MemoryTracker::startGMPTracking();
+			MemoryTracker::resetPeakUsage();
+			longUInt usage_begin = MemoryTracker::getCurrentUsage();
+
+			std::chrono::steady_clock::time_point t_begin = std::chrono::steady_clock::now();
+			std::vector<bigFloat> solution = index->calculate(mGame);
+
+			/*
+			 * Each value converted from the floating-point representation has a relative error of at most r. The normalized indices are ratios of non-negative combinations of these values, i.e. their relative error is at most (1 + r) / (1 - r) - 1 = 2r / (1 - r).
+			 */
+			double relative_error = lint::GlobalCalculator::getRelativeErrorBound();
+			bool too_inexact = false;
+			if (config.intRep == FLOAT && relative_error > 0) {
+				double index_error = (relative_error < 1) ? 2 * relative_error / (1 - relative_error) : std::numeric_limits<double>::infinity();
+				log::out << log::info << "Relative error bound of the floating-point calculation: " << index_error << log::endl;
+				too_inexact = index_error > mUserInputHandler->getMaxRelativeError();
+			}
+
+			if (lint::GlobalCalculator::hasOverflowed() || too_inexact) {
+				if (too_inexact) {
+					log::out << log::info << "The error bound exceeds " << mUserInputHandler->getMaxRelativeError() << "! Repeating the calculation using an exact integer representation" << log::endl;
+					config.intRep = DEFAULT;
+				} else {
+					log::out << log::info << "Overflow detected! Repeating the calculation using a larger integer representation" << log::endl;
+				}
+
+				index::IndexFactory::delete_powerIndex(index);
+				index = nullptr;
+				lint::GlobalCalculator::remove();
+
+				index = index::IndexFactory::new_powerIndex(idx, mGame, config.intRep);
+				lint::GlobalCalculator::init(config);
+
+				calculate = checkHardware(index->getMemoryRequirement(mGame));
+				if (calculate) {
+					solution = index->calculate(mGame);
+				}
+			}
+			std::chrono::steady_clock::time_point t_end = std::chrono::steady_clock::now();
+
+			MemoryTracker::stopGMPTracking();
+
+			if (calculate) {
+				if (idx == "W" || idx == "WM" || idx == "WS") { // single value calculation
+					mGame->setSingleValueSolution(solution[0]);
+				} else {
+					mGame->setSolution(solution);
+				}
+
+				log::out << log::info << "Calculation completed (" << std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_begin).count() << " µs)" << log::endl;
+				log::out << log::info << "Peak RAM usage: " << (MemoryTracker::getPeakUsage() - usage_begin) / cMemUnit_factor << " " << cMemUnit_name << log::endl;
+			}
+		}
+
+		if (!calculate) {
+			log::out << log::info << "Calculation aborted" << log::endl;
+		}
+	} catch (...) {
+		MemoryTracker::stopGMPTracking();
+		if (gCalculator != nullptr) {
+			lint::GlobalCalculator::remove();
+		}
+		index::IndexFactory::delete_powerIndex(index);
+		throw;
 	}
 
 	lint::GlobalCalculator::remove();
@@ -160,7 +272,11 @@ bool epic::SystemControlUnit::checkHardware(longUInt req) {
 	HardwareInfo hInfo;
 
 	log::out << log::info << "Approximated RAM usage: " << req << " " << cMemUnit_name << log::endl;
-	if (hInfo.getFreeRamSize() == 0) {
+	if (mUserInputHandler->getMemoryLimit() > 0) {
+		if (req > mUserInputHandler->getMemoryLimit()) {
+			throw std::runtime_error("The approximated RAM usage (" + std::to_string(req) + " " + cMemUnit_name + ") exceeds the memory limit (" + std::to_string(mUserInputHandler->getMemoryLimit()) + " " + cMemUnit_name + ")!");
+		}
+	} else if (hInfo.getFreeRamSize() == 0) {
 		log::out << log::warning << "Unable to read RAM size! (approximately needed: " << req << " " << cMemUnit_name << ")" << log::endl;
 	} else if (req > hInfo.getFreeRamSize()) {
 		if (req > hInfo.getTotalRamSize()) {
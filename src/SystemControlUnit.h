@@ -71,6 +71,9 @@ public:
        * Checks if the current computer hardware fits the requirements to compute the given index
        *
        * This method only produced user output (e.g. warnings). Even if the hardware does not meet the requirements this method will not throw an exception. Doing so enables the user to try the calculation. If the memory requirement is larger than the available one, the user gets asked whether to continue or not.
+       * If a memory limit was specified (see io::UserInputHandler::getMemoryLimit()), the user does not get asked. Instead an exception gets thrown if the memory requirement exceeds the limit.
+       *
+       * @throws std::runtime_error If the memory requirement exceeds the specified memory limit
        *
        * @param memory_requirement The required memory (given in cMemUnitName)
        * @return If the calculation should be done or not (user decision)
@@ -2,6 +2,7 @@
 
 #include "Logging.h"
 #include "PublicGood.h"
+#include "PublicGoodSolver.h"
 #include "GlobalCalculator.h"
 
 #include <cmath>
@@ -18,13 +19,11 @@ std::vector<epic::bigFloat> epic::index::ThreatPGI1::calculate(Game* g_) {
 	{
 		PublicGood* pgi = new PublicGood();
 		pgi->calculate(g, intSolution);
-
-		// Create game object from weights of precoalitions with original quota
-		auto precoalitionGame = new Game(g->getQuota(), g->getPrecoalitionWeights(), false);
-		pgi->calculate(precoalitionGame, externalSolution);
-
-		delete precoalitionGame;
 		delete pgi;
+
+		// external game: weights of precoalitions with original quota
+		PublicGoodSolver externalPgi;
+		externalPgi.calculate(g->getPrecoalitionWeights(), g->getQuota(), externalSolution);
 	}
 
 	std::vector<bigFloat> solution(g->getNumberOfPlayers(), 0.0); // initialize with zero
@@ -55,6 +54,7 @@ epic::longUInt epic::index::ThreatPGI1::getMemoryRequirement(Game* g_) {
 	bigInt memory = (g->getWeightSum() + 1 - g->getQuota()) * gCalculator->getLargeNumberSize();
 	memory += g->getMaxPrecoalitionSize() * gCalculator->getLargeNumberSize();
 	memory += g->getMaxPrecoalitionSize() * c_sizeof_longUInt;
+	memory += PublicGoodSolver::getMemoryRequirement(g->getNumberOfPrecoalitions(), g->getQuota()); // external game
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
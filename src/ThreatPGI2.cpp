@@ -1,7 +1,7 @@
 #include "ThreatPGI2.h"
 
 #include "Logging.h"
-#include "PublicGood.h"
+#include "PublicGoodSolver.h"
 #include "GlobalCalculator.h"
 
 #include <cmath>
@@ -13,14 +13,17 @@ std::vector<epic::bigFloat> epic::index::ThreatPGI2::calculate(Game* g_) {
 	auto g = static_cast<PrecoalitionGame*>(g_);
 	std::vector<bigFloat> solution(g->getNumberOfPlayers(), 0);
 
-	PublicGood* pgi = new PublicGood();
+	// all internal games and the external game share the helper tables
+	PublicGoodSolver pgi;
+	std::vector<longUInt> weightsVector;
+	std::vector<bigFloat> intSolution;
 
 	bigFloat denominator = 0.0;
 	for (longUInt i = 0; i < g->getNumberOfPrecoalitions(); i++) {
 		longUInt nbPlayersInParti = g->getPrecoalitions()[i].size();
 		longUInt nbIntGame = g->getNumberOfPrecoalitions() + nbPlayersInParti - 1;
 
-		std::vector<longUInt> weightsVector(nbIntGame);
+		weightsVector.resize(nbIntGame);
 		{ // fill weightsVector containing the player weights of precoalition i followed by the precoalition weights except precoalition i
 			for (longUInt ii = 0; ii < nbPlayersInParti; ii++) {
 				weightsVector[ii] = g->getWeights()[g->getPrecoalitions()[i][ii]];
@@ -33,32 +36,23 @@ std::vector<epic::bigFloat> epic::index::ThreatPGI2::calculate(Game* g_) {
 			}
 		}
 
-		// Create internal game for precoalition i
-		auto intGame = new Game(g->getQuota(), weightsVector, false);
-
-		std::vector<bigFloat> intSolution(nbIntGame);
-		pgi->calculate(intGame, intSolution);
-
-		std::vector<bigFloat> sortedSolution(nbIntGame);
-		intGame->getPermutation().reverse(intSolution, sortedSolution);
+		// internal game for precoalition i
+		pgi.calculate(weightsVector, g->getQuota(), intSolution);
 
 		denominator = 0.0;
 		for (longUInt ii = 0; ii < nbPlayersInParti; ii++) {
-			denominator += sortedSolution[ii];
+			denominator += intSolution[ii];
 		}
 		for (longUInt ii = 0; ii < nbPlayersInParti; ii++) {
 			if (denominator > 0) {
-				solution[g->getPrecoalitions()[i][ii]] = sortedSolution[ii] / denominator;
+				solution[g->getPrecoalitions()[i][ii]] = intSolution[ii] / denominator;
 			} // else solution[g->getPrecoalitions()[i][ii]] = 0.0;
 		}
-
-		delete intGame;
 	}
 
 	std::vector<bigFloat> externalSolution(g->getNumberOfPrecoalitions());
-	// Create game object from weights of precoalitions with original quota
-	auto precoalitionGame = new Game(g->getQuota(), g->getPrecoalitionWeights(), false);
-	pgi->calculate(precoalitionGame, externalSolution);
+	// external game: weights of precoalitions with original quota
+	pgi.calculate(g->getPrecoalitionWeights(), g->getQuota(), externalSolution);
 
 	// scale solution
 	for (longUInt i = 0; i < g->getNumberOfPrecoalitions(); ++i) {
@@ -67,9 +61,6 @@ std::vector<epic::bigFloat> epic::index::ThreatPGI2::calculate(Game* g_) {
 		}
 	}
 
-	delete precoalitionGame;
-	delete pgi;
-
 	return solution;
 }
 
@@ -83,6 +74,7 @@ epic::longUInt epic::index::ThreatPGI2::getMemoryRequirement(Game* g_) {
 	bigInt memory = (g->getWeightSum() + 1 - g->getQuota()) * gCalculator->getLargeNumberSize();
 	memory += g->getMaxPrecoalitionSize() * gCalculator->getLargeNumberSize() * 4;
 	memory += g->getMaxPrecoalitionSize() * c_sizeof_longUInt;
+	memory += PublicGoodSolver::getMemoryRequirement(g->getNumberOfPrecoalitions() + g->getMaxPrecoalitionSize() - 1, g->getQuota()); // internal and external games
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
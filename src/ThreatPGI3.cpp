@@ -1,9 +1,12 @@
 #include "ThreatPGI3.h"
 
 #include "Logging.h"
-#include "PublicGood.h"
+#include "PublicGoodSolver.h"
 #include "GlobalCalculator.h"
 
+#include <algorithm>
+#include <functional>
+
 epic::index::ThreatPGI3::ThreatPGI3()
 	: PowerIndexWithPrecoalitions() {}
 
@@ -11,36 +14,24 @@ std::vector<epic::bigFloat> epic::index::ThreatPGI3::calculate(Game* g_) {
 	auto g = static_cast<PrecoalitionGame*>(g_);
 	std::vector<bigFloat> solution(g->getNumberOfPlayers());
 
-	PublicGood* pgi = new PublicGood();
-
 	const bigFloat cFloatOne("1");
 	bigFloat denominator = 0;
 
-	std::vector<bigFloat> intSolution(g->getNumberOfPrecoalitions() + 1);
+	ArrayOffset<lint::LargeNumber> f(g->getQuota(), 0);
+	gCalculator->alloc_largeNumberArray(f.getArrayPointer(), f.getNumberOfElements());
+	ArrayOffset<lint::LargeNumber> card(g->getQuota(), 0);
+	gCalculator->alloc_largeNumberArray(card.getArrayPointer(), card.getNumberOfElements());
+	ArrayOffset<lint::LargeNumber> f_prefix(g->getQuota() + 1, 0);
+	gCalculator->alloc_largeNumberArray(f_prefix.getArrayPointer(), f_prefix.getNumberOfElements());
+	ArrayOffset<lint::LargeNumber> card_prefix(g->getQuota() + 1, 0);
+	gCalculator->alloc_largeNumberArray(card_prefix.getArrayPointer(), card_prefix.getNumberOfElements());
+
 	std::vector<bigFloat> intPGIs(g->getMaxPrecoalitionSize());
-	std::vector<longUInt> weightsVector(g->getNumberOfPrecoalitions() + 1);
 
 	for (longUInt i = 0; i < g->getNumberOfPrecoalitions(); i++) {
 		longUInt nbPlayersInParti = g->getPrecoalitions()[i].size();
 
-		for (longUInt ii = 0; ii < nbPlayersInParti; ii++) {
-			{ // fill weightsVector with the weight of player ii, the weight of precoalition i without player ii followed by the weights of the remaining precoalitions except precoalition i
-				weightsVector[0] = g->getWeights()[g->getPrecoalitions()[i][ii]];
-				weightsVector[1] = g->getPrecoalitionWeights()[i] - weightsVector[0];
-				for (longUInt j = 0; j < i; j++) {
-					weightsVector[j + 2] = g->getPrecoalitionWeights()[j];
-				}
-				for (longUInt j = i + 1; j < g->getNumberOfPrecoalitions(); j++) {
-					weightsVector[j + 1] = g->getPrecoalitionWeights()[j];
-				}
-			}
-
-			auto intGame = new Game(g->getQuota(), weightsVector, false);
-			pgi->calculate(intGame, intSolution);
-			intPGIs[ii] = intSolution[intGame->getPermutation().applyIndex(0)]; // the solution for player ii
-
-			delete intGame;
-		}
+		internalPublicGoods(g, i, f, card, f_prefix, card_prefix, intPGIs);
 
 		denominator = 0.0;
 		for (longUInt ii = 0; ii < nbPlayersInParti; ii++) {
@@ -56,17 +47,18 @@ std::vector<epic::bigFloat> epic::index::ThreatPGI3::calculate(Game* g_) {
 		}
 	}
 
-	intSolution.clear();
 	intPGIs.clear();
-	weightsVector.clear();
+	gCalculator->free_largeNumberArray(f.getArrayPointer());
+	gCalculator->free_largeNumberArray(card.getArrayPointer());
+	gCalculator->free_largeNumberArray(f_prefix.getArrayPointer());
+	gCalculator->free_largeNumberArray(card_prefix.getArrayPointer());
 
 	// calculate external game
 	std::vector<bigFloat> externalSolution(g->getNumberOfPrecoalitions());
-	auto precoalitionGame = new Game(g->getQuota(), g->getPrecoalitionWeights(), false); // Create game object from weights of precoalitions with original quota
-	pgi->calculate(precoalitionGame, externalSolution);
-
-	delete precoalitionGame;
-	delete pgi;
+	{
+		PublicGoodSolver pgi;
+		pgi.calculate(g->getPrecoalitionWeights(), g->getQuota(), externalSolution); // weights of precoalitions with original quota
+	}
 
 	// scale solution
 	for (longUInt i = 0; i < g->getNumberOfPrecoalitions(); i++) {
@@ -85,9 +77,10 @@ std::string epic::index::ThreatPGI3::getFullName() {
 epic::longUInt epic::index::ThreatPGI3::getMemoryRequirement(Game* g_) {
 	auto g = static_cast<PrecoalitionGame*>(g_);
 
-	bigInt memory = (g->getWeightSum() + 1 - g->getQuota()) * gCalculator->getLargeNumberSize();
-	memory += g->getMaxPrecoalitionSize() * gCalculator->getLargeNumberSize() * 4;
-	memory += g->getMaxPrecoalitionSize() * c_sizeof_longUInt;
+	bigInt memory = (bigInt(g->getQuota()) * 4 + 2) * gCalculator->getLargeNumberSize();			 // f, card, f_prefix, card_prefix
+	memory += g->getMaxPrecoalitionSize() * 6 * gCalculator->getLargeNumberSize();					 // count, cardinality
+	memory += (g->getMaxPrecoalitionSize() * 9 + g->getNumberOfPrecoalitions()) * c_sizeof_longUInt; // extra, lightest, heavier, others
+	memory += PublicGoodSolver::getMemoryRequirement(g->getNumberOfPrecoalitions(), g->getQuota());	 // external game
 	memory /= cMemUnit_factor;
 
 	longUInt ret = 0;
@@ -104,3 +97,162 @@ epic::bigInt epic::index::ThreatPGI3::getMaxValueRequirement(ItfUpperBoundApprox
 epic::lint::Operation epic::index::ThreatPGI3::getOperationRequirement() {
 	return lint::Operation::multiplication;
 }
+
+void epic::index::ThreatPGI3::internalPublicGoods(PrecoalitionGame* g, longUInt i, ArrayOffset<lint::LargeNumber>& f, ArrayOffset<lint::LargeNumber>& card, ArrayOffset<lint::LargeNumber>& f_prefix, ArrayOffset<lint::LargeNumber>& card_prefix, std::vector<bigFloat>& intPGIs) {
+	longUInt quota = g->getQuota();
+	longUInt nbPlayersInParti = g->getPrecoalitions()[i].size();
+	longUInt weight_i = g->getPrecoalitionWeights()[i];
+
+	// the other precoalitions (O) in descending order. Precoalitions of weight zero are never part of a minimal winning coalition.
+	std::vector<longUInt> others;
+	for (longUInt j = 0; j < g->getNumberOfPrecoalitions(); ++j) {
+		if (j != i && g->getPrecoalitionWeights()[j] > 0) {
+			others.push_back(g->getPrecoalitionWeights()[j]);
+		}
+	}
+	std::sort(others.begin(), others.end(), std::greater<>());
+
+	/*
+	 * Three windows per member ii: the subsets S' of O forming a minimal winning coalition together with {a} (k = 3 * ii), {c} (k = 3 * ii + 1) or {a, c} (k = 3 * ii + 2).
+	 * extra[k]: the weight of the extra players, lightest[k]: the weight of the lightest extra player, heavier[k]: the number of precoalitions in O not lighter than lightest[k]
+	 * count[k]: the number of these subsets S', cardinality[k]: the sum of their cardinalities
+	 */
+	longUInt nbWindows = 3 * nbPlayersInParti;
+	std::vector<longUInt> extra(nbWindows), lightest(nbWindows), heavier(nbWindows);
+	for (longUInt ii = 0; ii < nbPlayersInParti; ++ii) {
+		longUInt a = g->getWeights()[g->getPrecoalitions()[i][ii]];
+		longUInt c = weight_i - a;
+
+		extra[3 * ii] = a;
+		lightest[3 * ii] = a;
+		extra[3 * ii + 1] = c;
+		lightest[3 * ii + 1] = c;
+		extra[3 * ii + 2] = weight_i;
+		lightest[3 * ii + 2] = std::min(a, c);
+	}
+	for (longUInt k = 0; k < nbWindows; ++k) {
+		heavier[k] = std::upper_bound(others.begin(), others.end(), lightest[k], std::greater<>()) - others.begin();
+	}
+
+	auto count = new lint::LargeNumber[nbWindows];
+	gCalculator->allocInit_largeNumberArray(count, nbWindows);
+	auto cardinality = new lint::LargeNumber[nbWindows];
+	gCalculator->allocInit_largeNumberArray(cardinality, nbWindows);
+
+	// sum of the cardinalities of the minimal winning coalitions contained in O
+	lint::LargeNumber cardinality_O;
+	gCalculator->allocInit_largeNumber(cardinality_O);
+
+	lint::LargeNumber tmp;
+	gCalculator->alloc_largeNumber(tmp);
+
+	// x - y if x > y, 0 otherwise
+	auto difference = [](longUInt x, longUInt y) {
+		return (x > y) ? x - y : 0;
+	};
+
+	// dest += prefix[end] - prefix[begin]
+	auto addWindow = [&tmp](lint::LargeNumber& dest, ArrayOffset<lint::LargeNumber>& prefix, longUInt begin, longUInt end) {
+		if (begin < end) {
+			gCalculator->minus(tmp, prefix[end], prefix[begin]);
+			gCalculator->plusEqual(dest, tmp);
+		}
+	};
+
+	auto updatePrefixSums = [&]() {
+		gCalculator->assign_zero(f_prefix[0]);
+		gCalculator->assign_zero(card_prefix[0]);
+		for (longUInt x = 0; x < quota; ++x) {
+			gCalculator->plus(f_prefix[x + 1], f_prefix[x], f[x]);
+			gCalculator->plus(card_prefix[x + 1], card_prefix[x], card[x]);
+		}
+	};
+
+	// S' only contains precoalitions not lighter than the lightest extra player: weight(S') in [quota - extra, quota - extra + lightest)
+	auto addHeavierWindows = [&](longUInt number_of_players) {
+		for (longUInt k = 0; k < nbWindows; ++k) {
+			if (heavier[k] == number_of_players) {
+				longUInt begin = difference(quota, extra[k]);
+				longUInt end = difference(quota + lightest[k], extra[k]);
+				addWindow(count[k], f_prefix, begin, end);
+				addWindow(cardinality[k], card_prefix, begin, end);
+			}
+		}
+	};
+
+	// subset sum tables of O (restricted to the weights below the quota)
+	gCalculator->assign_zero(&f[0], quota);
+	gCalculator->assign_one(f[0]);
+	gCalculator->assign_zero(&card[0], quota);
+	for (longUInt wl : others) {
+		// card[x] += card[x - wl] + f[x - wl], f[x] += f[x - wl]. Blocks of wl consecutive weights do not overlap their targets and get added starting at the top.
+		for (longUInt end = difference(quota, wl); end > 0;) {
+			longUInt begin = (end > wl) ? end - wl : 0;
+			gCalculator->plusEqual(&card[begin + wl], &card[begin], end - begin);
+			gCalculator->plusEqual(&card[begin + wl], &f[begin], end - begin);
+			gCalculator->plusEqual(&f[begin + wl], &f[begin], end - begin);
+			end = begin;
+		}
+	}
+
+	updatePrefixSums();
+	addHeavierWindows(others.size());
+
+	// removing the precoalitions of O from the lightest to the heaviest one
+	for (longUInt l = others.size(); l > 0; --l) {
+		longUInt wl = others[l - 1];
+
+		// the tables now only contain the subsets of the l - 1 heaviest precoalitions
+		for (longUInt begin = wl; begin < quota; begin += wl) {
+			longUInt size = std::min(wl, quota - begin);
+			gCalculator->minus(&f[begin], &f[begin], &f[begin - wl], size);
+			gCalculator->minus(&card[begin], &card[begin], &card[begin - wl], size);
+			gCalculator->minus(&card[begin], &card[begin], &f[begin - wl], size);
+		}
+
+		updatePrefixSums();
+
+		/*
+		 * S' with precoalition l as its lightest precoalition: weight(S') in [quota - extra, quota - extra + wl), i.e. the weight of S' without l is in [quota - extra - wl, quota - extra). Each one contains one precoalition more than the corresponding subset of the l - 1 heaviest precoalitions.
+		 */
+		for (longUInt k = 0; k < nbWindows; ++k) {
+			if (wl < lightest[k]) {
+				longUInt begin = difference(quota, extra[k] + wl);
+				longUInt end = difference(quota, extra[k]);
+				addWindow(count[k], f_prefix, begin, end);
+				addWindow(cardinality[k], card_prefix, begin, end);
+				addWindow(cardinality[k], f_prefix, begin, end);
+			}
+		}
+
+		// minimal winning coalitions contained in O having precoalition l as its lightest precoalition
+		addWindow(cardinality_O, card_prefix, difference(quota, wl), quota);
+		addWindow(cardinality_O, f_prefix, difference(quota, wl), quota);
+
+		addHeavierWindows(l - 1);
+	}
+
+	// the Public Good index of member ii: number of minimal winning coalitions containing a divided by the sum of the cardinalities of all minimal winning coalitions
+	bigInt big_count[3], big_cardinality[3], big_cardinality_O;
+	gCalculator->to_bigInt(&big_cardinality_O, cardinality_O);
+	for (longUInt ii = 0; ii < nbPlayersInParti; ++ii) {
+		for (longUInt x = 0; x < 3; ++x) {
+			gCalculator->to_bigInt(&big_count[x], count[3 * ii + x]);
+			gCalculator->to_bigInt(&big_cardinality[x], cardinality[3 * ii + x]);
+		}
+
+		bigInt mwc_a = big_count[0] + big_count[2];
+		bigInt mwc_c = big_count[1] + big_count[2];
+		bigInt mwc_sum = mwc_a + mwc_c + big_cardinality_O + big_cardinality[0] + big_cardinality[1] + big_cardinality[2];
+
+		intPGIs[ii] = mwc_a;
+		intPGIs[ii] /= bigFloat(mwc_sum);
+	}
+
+	gCalculator->free_largeNumber(tmp);
+	gCalculator->free_largeNumber(cardinality_O);
+	gCalculator->free_largeNumberArray(cardinality);
+	delete[] cardinality;
+	gCalculator->free_largeNumberArray(count);
+	delete[] count;
+}
@@ -14,6 +14,26 @@ public:
 	longUInt getMemoryRequirement(Game* g) override;
 	bigInt getMaxValueRequirement(ItfUpperBoundApproximation* approx) override;
 	lint::Operation getOperationRequirement() override;
+
+private:
+	/**
+	 * Calculating the Public Good index of player <i>a</i> in the internal games of all members of precoalition <i>i</i>
+	 *
+	 * The internal game of member <i>a</i> consists of <i>a</i>, the rest <i>c</i> of precoalition <i>i</i> (weight \f$w_i - w_a\f$) and the other precoalitions <i>O</i>. A minimal winning coalition either is a subset of <i>O</i> or consists of a subset \f$S' \subseteq O\f$ together with {a}, {c} or {a, c}. Ordering <i>O</i> by decreasing weight, \f$S'\f$ is either a subset of the precoalitions not lighter than the lightest extra player, or it has a lightest precoalition <i>l</i>. In both cases the minimality only restricts the weight of \f$S'\f$ to a window. Therefore the number of these coalitions (and the sum of their cardinalities) are window sums of the subset sum tables of <i>O</i>:
+	 * - The tables of <i>O</i> get calculated once per precoalition <i>i</i>.
+	 * - The precoalitions of <i>O</i> get removed again from the lightest to the heaviest one (deconvolution). After each step all windows of all members belonging to the removed precoalition <i>l</i> get added using prefix sums.
+	 *
+	 * I.e. each member only costs \f$O(|O|)\f$ operations instead of a Public Good calculation of its own internal game.
+	 *
+	 * @param g The Game object for the current calculation
+	 * @param i The precoalition index
+	 * @param f Helper table (quota elements): number of subsets of <i>O</i> per weight
+	 * @param card Helper table (quota elements): sum of the cardinalities of the subsets of <i>O</i> per weight
+	 * @param f_prefix Helper table (quota + 1 elements): prefix sums of f
+	 * @param card_prefix Helper table (quota + 1 elements): prefix sums of card
+	 * @param intPGIs Return vector: intPGIs[ii] is the Public Good index of member ii in its internal game. It must contain at least as many elements as precoalition <i>i</i> has members.
+	 */
+	void internalPublicGoods(PrecoalitionGame* g, longUInt i, ArrayOffset<lint::LargeNumber>& f, ArrayOffset<lint::LargeNumber>& card, ArrayOffset<lint::LargeNumber>& f_prefix, ArrayOffset<lint::LargeNumber>& card_prefix, std::vector<bigFloat>& intPGIs);
 };
 
 } // namespace epic::index
@@ -2,6 +2,8 @@
 
 #include "Logging.h"
 
+#include <algorithm>
+
 epic::lint::UIntCalculator::UIntCalculator() {
 	log::out << log::info << "Using unsigned integer" << log::endl;
 }
@@ -26,10 +28,44 @@ void epic::lint::UIntCalculator::plusEqual(LargeNumber& dest, const LargeNumber&
 	dest.uint += op.uint;
 }
 
+/**
+ * @note If op lies behind dest inside the span (distance d = op - dest < n), each block of d consecutive elements is independent of the others. The blocks get processed one after another, each one in a loop the compiler can vectorize.
+ */
+void epic::lint::UIntCalculator::plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) {
+	longUInt block = n;
+	if (op > dest && static_cast<longUInt>(op - dest) < n) {
+		block = op - dest;
+	}
+
+	for (longUInt begin = 0; begin < n; begin += block) {
+		longUInt size = std::min(block, n - begin);
+		LargeNumber* __restrict d = dest + begin;
+		const LargeNumber* __restrict o = op + begin;
+
+		for (longUInt i = 0; i < size; ++i) {
+			d[i].uint += o[i].uint;
+		}
+	}
+}
+
+void epic::lint::UIntCalculator::plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) {
+	longUInt sum = dest.uint;
+	for (longUInt i = 0; i < n; ++i) {
+		sum += op[i * stride].uint;
+	}
+	dest.uint = sum;
+}
+
 void epic::lint::UIntCalculator::minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) {
 	dest.uint = op1.uint - op2.uint;
 }
 
+void epic::lint::UIntCalculator::minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		dest[i].uint = op1[i].uint - op2[i].uint;
+	}
+}
+
 void epic::lint::UIntCalculator::minusEqual(LargeNumber& dest, const LargeNumber& op) {
 	dest.uint -= op.uint;
 }
@@ -58,6 +94,16 @@ void epic::lint::UIntCalculator::assign_zero(LargeNumber& dest) {
 	dest.uint = 0;
 }
 
+void epic::lint::UIntCalculator::assign(LargeNumber* dest, const LargeNumber* src, longUInt n) {
+	std::copy(src, src + n, dest);
+}
+
+void epic::lint::UIntCalculator::assign_zero(LargeNumber* dest, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		dest[i].uint = 0;
+	}
+}
+
 void epic::lint::UIntCalculator::assign_one(LargeNumber& dest) {
 	dest.uint = 1;
 }
@@ -66,6 +112,12 @@ void epic::lint::UIntCalculator::to_bigInt(bigInt* dest, const LargeNumber& valu
 	mpz_set_ui(dest->get_mpz_t(), value.uint);
 }
 
+void epic::lint::UIntCalculator::to_double(double* dest, const LargeNumber* value, longUInt n) {
+	for (longUInt i = 0; i < n; ++i) {
+		dest[i] = static_cast<double>(value[i].uint);
+	}
+}
+
 void epic::lint::UIntCalculator::alloc_largeNumberArray(LargeNumber* array, longUInt number_of_elements) {
 	// nothing to do here
 }
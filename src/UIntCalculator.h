@@ -23,7 +23,10 @@ public:
 	void plus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
 	void plusEqual(LargeNumber& dest, const longUInt& op) override;
 	void plusEqual(LargeNumber& dest, const LargeNumber& op) override;
+	void plusEqual(LargeNumber* dest, const LargeNumber* op, longUInt n) override;
+	void plusEqualSum(LargeNumber& dest, const LargeNumber* op, longUInt n, longUInt stride) override;
 	void minus(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
+	void minus(LargeNumber* dest, const LargeNumber* op1, const LargeNumber* op2, longUInt n) override;
 	void minusEqual(LargeNumber& dest, const LargeNumber& op) override;
 	void mul(LargeNumber& dest, const LargeNumber& op1, const longUInt& op2) override;
 	void mul(LargeNumber& dest, const LargeNumber& op1, const LargeNumber& op2) override;
@@ -32,9 +35,12 @@ public:
 	void assign(LargeNumber& dest, const LargeNumber& value) override;
 	void assign(LargeNumber& dest, const longUInt& value) override;
 	void assign_zero(LargeNumber& dest) override;
+	void assign(LargeNumber* dest, const LargeNumber* src, longUInt n) override;
+	void assign_zero(LargeNumber* dest, longUInt n) override;
 	void assign_one(LargeNumber& dest) override;
 
 	void to_bigInt(bigInt* dest, const LargeNumber& value) override;
+	void to_double(double* dest, const LargeNumber* value, longUInt n) override;
 
 	void alloc_largeNumberArray(LargeNumber* array, longUInt number_of_elements) override;
 	void allocInit_largeNumberArray(LargeNumber* array, longUInt number_of_elements) override;
@@ -4,10 +4,13 @@
 #include "IndexFactory.h"
 #include "DataInput.h"
 
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
 #include <getopt.h>
 #include <string>
 
-epic::io::UserInputHandler::UserInputHandler(const std::string& index, const std::vector<longUInt>& weights, longUInt quota, std::vector<std::vector<int>> precoalitions, OutputType outputType, bool filterNullPlayers, bool verbose) {
+epic::io::UserInputHandler::UserInputHandler(const std::string& index, const std::vector<longUInt>& weights, longUInt quota, std::vector<std::vector<int>> precoalitions, OutputType outputType, bool filterNullPlayers, bool verbose, longUInt memoryLimit, longUInt numberOfThreads, bool fastMode, double maxRelativeError) {
 	mIndex = index;
 	mWeights = weights;
 	mQuota = quota;
@@ -17,7 +20,10 @@ epic::io::UserInputHandler::UserInputHandler(const std::string& index, const std
 	mPrecoalitionFlag = false;
 	mInputFloatWeights = false;
 	mFilterNullPlayers = filterNullPlayers;
-	mIntRepresentation = DEFAULT;
+	mIntRepresentation = fastMode ? FLOAT : DEFAULT;
+	mMemoryLimit = memoryLimit;
+	mNumberOfThreads = numberOfThreads;
+	mMaxRelativeError = maxRelativeError;
 	mWeightsFile = "";
 	
 	if (verbose) {
@@ -40,6 +46,9 @@ epic::io::UserInputHandler::UserInputHandler() {
 	mInputFloatWeights = false;
 	mFilterNullPlayers = false;
 	mIntRepresentation = DEFAULT;
+	mMemoryLimit = 0;
+	mNumberOfThreads = 1;
+	mMaxRelativeError = 1e-12;
 	mWeightsFile = "";
 	mPrecoalitions.clear();
 }
@@ -137,6 +146,22 @@ bool epic::io::UserInputHandler::handleQuota(char* value) {
 	}
 }
 
+bool epic::io::UserInputHandler::readUnsignedInteger(const char* value, longUInt& result) {
+	if (value == nullptr || !std::isdigit(static_cast<unsigned char>(value[0]))) {
+		return false;
+	}
+
+	char* end = nullptr;
+	errno = 0;
+	unsigned long long tmp = std::strtoull(value, &end, 10);
+	if (errno != 0 || *end != '\0') {
+		return false;
+	}
+
+	result = tmp;
+	return true;
+}
+
 bool epic::io::UserInputHandler::handleIndex(char* value) {
 	bool ret = false;
 
@@ -156,9 +181,13 @@ bool epic::io::UserInputHandler::parseCommandLine(int numberOfArguments, char* v
 	enum LongOpts {
 		OPT_GMP,
 		OPT_PRIMES,
+		OPT_FAST,
 		OPT_FLOAT,
 		OPT_CSV,
-		OPT_QUIET
+		OPT_QUIET,
+		OPT_MEMORY_LIMIT,
+		OPT_THREADS,
+		OPT_FAST_TOLERANCE
 	};
 
 	static struct option long_options[] = {
@@ -169,9 +198,13 @@ bool epic::io::UserInputHandler::parseCommandLine(int numberOfArguments, char* v
 		{"filter-null", no_argument, nullptr, 'f'},
 		{"gmp", no_argument, nullptr, OPT_GMP},
 		{"primes", no_argument, nullptr, OPT_PRIMES},
+		{"fast", no_argument, nullptr, OPT_FAST},
 		{"float", no_argument, nullptr, OPT_FLOAT},
 		{"csv", no_argument, nullptr, OPT_CSV},
 		{"quiet", no_argument, nullptr, OPT_QUIET},
+		{"memory-limit", required_argument, nullptr, OPT_MEMORY_LIMIT},
+		{"threads", required_argument, nullptr, OPT_THREADS},
+		{"fast-tolerance", required_argument, nullptr, OPT_FAST_TOLERANCE},
 		{"help", no_argument, nullptr, 'h'},
 		{nullptr, 0, nullptr, 0}};
 	int arg_count = 0;
@@ -274,7 +307,7 @@ bool epic::io::UserInputHandler::parseCommandLine(int numberOfArguments, char* v
 				if (mIntRepresentation == DEFAULT) {
 					mIntRepresentation = GMP;
 				} else {
-					log::out << log::warning << "Incompatible options: --gmp and --primes" << log::endl;
+					log::out << log::warning << "Incompatible options: --gmp, --primes and --fast" << log::endl;
 					return false;
 				}
 				break;
@@ -283,7 +316,16 @@ bool epic::io::UserInputHandler::parseCommandLine(int numberOfArguments, char* v
 				if (mIntRepresentation == DEFAULT) {
 					mIntRepresentation = PRIMES;
 				} else {
-					log::out << log::warning << "Incompatible options: --gmp and --primes" << log::endl;
+					log::out << log::warning << "Incompatible options: --gmp, --primes and --fast" << log::endl;
+					return false;
+				}
+				break;
+
+			case OPT_FAST:
+				if (mIntRepresentation == DEFAULT) {
+					mIntRepresentation = FLOAT;
+				} else {
+					log::out << log::warning << "Incompatible options: --gmp, --primes and --fast" << log::endl;
 					return false;
 				}
 				break;
@@ -296,6 +338,28 @@ bool epic::io::UserInputHandler::parseCommandLine(int numberOfArguments, char* v
 				mOutputType = csv;
 				break;
 
+			case OPT_MEMORY_LIMIT:
+				if (!readUnsignedInteger(optarg, mMemoryLimit) || mMemoryLimit == 0) {
+					log::out << log::warning << "The --memory-limit option requires an integer argument > 0." << log::endl;
+					return false;
+				}
+				break;
+
+			case OPT_THREADS:
+				if (!readUnsignedInteger(optarg, mNumberOfThreads)) {
+					log::out << log::warning << "The --threads option requires an integer argument >= 0 (0 for all hardware threads)." << log::endl;
+					return false;
+				}
+				break;
+
+			case OPT_FAST_TOLERANCE:
+				if (std::atof(optarg) <= 0) {
+					log::out << log::warning << "The --fast-tolerance option requires an argument > 0." << log::endl;
+					return false;
+				}
+				mMaxRelativeError = std::atof(optarg);
+				break;
+
 			case '?':
 				log::out << log::warning << "Unknown option: " << vectorOfArguments[optind - 1] << log::endl;
 				return false;
@@ -348,6 +412,18 @@ epic::IntRepresentation epic::io::UserInputHandler::getIntRepresentation() const
 	return mIntRepresentation;
 }
 
+epic::longUInt epic::io::UserInputHandler::getMemoryLimit() const {
+	return mMemoryLimit;
+}
+
+epic::longUInt epic::io::UserInputHandler::getNumberOfThreads() const {
+	return mNumberOfThreads;
+}
+
+double epic::io::UserInputHandler::getMaxRelativeError() const {
+	return mMaxRelativeError;
+}
+
 std::string epic::io::UserInputHandler::getWeightsFileName() const {
 	return mWeightsFile;
 }
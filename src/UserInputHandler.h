@@ -21,8 +21,12 @@ static const std::string MSG_REQUIRED_OPTS = "--index | -i <index abbreviation>
 
 static const std::string MSG_OPTIONAL_OPTS = "--filter-null | -f : Flag to filter out null players.\n"
 											 "--verbose | -v : Flag to provide additional details of the computation.\n"
-											 "--gmp : Flag to use the GMP library for large integer representation. Setting this flag will make the memory prediction unreliable due to dynamic memory allocations!\n"
+											 "--gmp : Flag to use the GMP library for large integer representation\n"
 											 "--primes : Flag to use the Chinese Remainder Theorem for large integer representation\n"
+											 "--fast : Flag to use floating-point numbers instead of large integers (only for the indices BZ, SH, PG and DP). The calculation gets repeated exactly if the bound on the relative error of the results exceeds the tolerance\n"
+											 "--fast-tolerance <number> : The tolerance of the --fast option (default: 1e-12)\n"
+											 "--memory-limit <integer> : The maximum amount of memory (in KiB) the tables of the calculation may use. If set, the calculation gets aborted with an error as soon as a table allocation would exceed the limit (instead of asking whether to proceed). The memory dynamically allocated by GMP counts for the usage but is not refused.\n"
+											 "--threads <integer> : The maximum number of threads used for the calculation (default: 1). 0 uses all hardware threads.\n"
 											 "--float : Flag to input float values from csv. Setting this flag will find an integer representation of a given floating-point problem, which is in no way minimal or optimal\n"
 											 "--csv : Flag to output the solution in a csv file.\n";
 
@@ -87,6 +91,21 @@ private:
     */
 	IntRepresentation mIntRepresentation;
 
+	/**
+    * The maximum amount of memory (in <cMemUnit_name>) the tables of the calculation are allowed to use (see MemoryTracker::setLimit()). 0 means no limit.
+    */
+	longUInt mMemoryLimit;
+
+	/**
+    * The maximum number of threads used for the calculation (default: 1). 0 means the number of hardware threads.
+    */
+	longUInt mNumberOfThreads;
+
+	/**
+    * The maximum relative error bound of the results calculated using floating-point numbers (see IntRepresentation::FLOAT). Above, the calculation gets repeated exactly.
+    */
+	double mMaxRelativeError;
+
 	/**
     * Name of the file containing the weights
     */
@@ -129,6 +148,11 @@ private:
     */
 	bool handleIndex(char* value);
 
+	/**
+    * Method used to read a non-negative integer option. Returns false if the value is not a (complete) non-negative integer.
+    */
+	static bool readUnsignedInteger(const char* value, longUInt& result);
+
 public:
 	/**
      * Constructor A: For the R interface where the input is given as arguments
@@ -140,8 +164,12 @@ public:
      * @param outputType the output type as depicted in enum OutputType
      * @param filterNullPlayers flag to filter out null players
      * @param verbose flag to provide additional details of the computation
+     * @param memoryLimit the maximum amount of memory (in <cMemUnit_name>) the tables of the calculation are allowed to use (0: no limit)
+     * @param numberOfThreads the maximum number of threads used for the calculation (default: 1, 0: number of hardware threads)
+     * @param fastMode flag to use floating-point numbers instead of large integers (see IntRepresentation::FLOAT)
+     * @param maxRelativeError the maximum relative error bound of the results in fast mode (above, the calculation gets repeated exactly)
      */
-	UserInputHandler(const std::string& index, const std::vector<longUInt>& weights, longUInt quota, std::vector<std::vector<int>> precoalitions, OutputType outputType, bool filterNullPlayers, bool verbose);
+	UserInputHandler(const std::string& index, const std::vector<longUInt>& weights, longUInt quota, std::vector<std::vector<int>> precoalitions, OutputType outputType, bool filterNullPlayers, bool verbose, longUInt memoryLimit = 0, longUInt numberOfThreads = 1, bool fastMode = false, double maxRelativeError = 1e-12);
 
 	/**
      * Constructor B: For the input from console
@@ -200,10 +228,31 @@ public:
 	/**
      * Method to return integer representation to use
      *
-     * --gmp & --primes
+     * --gmp & --primes & --fast
      */
 	IntRepresentation getIntRepresentation() const;
 
+	/**
+     * Method to return the memory limit in <cMemUnit_name> (0: no limit)
+     *
+     * --memory-limit \<longUInt\>
+     */
+	longUInt getMemoryLimit() const;
+
+	/**
+     * Method to return the maximum number of threads (0: number of hardware threads)
+     *
+     * --threads \<longUInt\>
+     */
+	longUInt getNumberOfThreads() const;
+
+	/**
+     * Method to return the maximum relative error bound of the results in fast mode
+     *
+     * --fast-tolerance \<double\>
+     */
+	double getMaxRelativeError() const;
+
 	/**
      * Method to return the flag for the verbosity
      *
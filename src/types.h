@@ -31,7 +31,8 @@ static const std::string cMemUnit_name = "KiB";
 enum IntRepresentation {
 	GMP,	/**< Using the GMP-library */
 	PRIMES, /**< Using the Chinese Remainder Theorem */
-	DEFAULT /**< for number of primes p <= 4 PRIMES, for p > 4 GMP */
+	DEFAULT, /**< for number of primes p <= 4 PRIMES, for p > 4 GMP (if p > 1, a calculation using single integers with overflow detection gets tried first) */
+	FLOAT	/**< Using scaled floating-point numbers with a bound on the relative error (see lint::FloatCalculator), only for the normalized indices BZ, SH, PG and DP. If the range of the floating-point types is too small, DEFAULT gets used */
 };
 
 static constexpr longUInt c_sizeof_longUInt = sizeof(longUInt);